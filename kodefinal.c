@@ -14,8 +14,8 @@
 #include <math.h>
 #include <string.h>
 
-#define MAX_ROWS 100
-#define MAX_YEARS 100
+#define INITIAL_ROWS 1024         // Kapasitas awal array data, digandakan saat penuh
+#define READ_CHUNK_SIZE (1 << 20) // Ukuran blok pembacaan file (1 MiB)
 #define MISSING_YEARS 4
 #define MAX_DEGREE 3  // Derajat maksimum untuk polinomial
 
@@ -26,42 +26,122 @@ typedef struct {
     double population;
 } DataRow;
 
-// Fungsi untuk membaca data dari file CSV
-int readCSV(const char* filename, DataRow data[], int* years) {
-    FILE* file = fopen(filename, "r");
+// Fungsi untuk mengurai satu baris CSV "tahun,persentase,populasi".
+// Kolom yang kosong atau tidak ada bernilai 0.
+void parseCSVLine(const char* line, DataRow* row) {
+    char* end;
+    row->year = (int)strtol(line, &end, 10);
+    row->percentage = 0;
+    row->population = 0;
+
+    if (*end == ',') {
+        row->percentage = strtod(end + 1, &end);
+    }
+    if (*end == ',') {
+        row->population = strtod(end + 1, &end);
+    }
+}
+
+// Fungsi untuk membaca data dari file CSV (tanpa batas jumlah baris).
+// File dibaca per blok READ_CHUNK_SIZE byte dan baris diurai langsung dari buffer,
+// sedangkan kapasitas array hasil digandakan setiap kali penuh.
+// *data dan *years dialokasikan di sini dan harus di-free oleh pemanggil.
+int readCSV(const char* filename, DataRow** data, int** years) {
+    *data = NULL;
+    *years = NULL;
+
+    FILE* file = fopen(filename, "rb");
     if (file == NULL) {
         printf("Error: Tidak dapat membuka file %s\n", filename);
         return 0;
     }
 
-    char line[256];
+    size_t buffer_size = READ_CHUNK_SIZE;
+    char* buffer = (char*)malloc(buffer_size + 1);
+    int capacity = INITIAL_ROWS;
+    DataRow* rows_data = (DataRow*)malloc(capacity * sizeof(DataRow));
+    int* rows_years = (int*)malloc(capacity * sizeof(int));
+    if (buffer == NULL || rows_data == NULL || rows_years == NULL) {
+        printf("Error: Memori tidak cukup untuk membaca file %s\n", filename);
+        free(buffer);
+        free(rows_data);
+        free(rows_years);
+        fclose(file);
+        return 0;
+    }
+
     int rows = 0;
-    
-    // Baca header
-    fgets(line, sizeof(line), file);
-    
-    // Baca data
-    while (fgets(line, sizeof(line), file) && rows < MAX_ROWS) {
-        char* token = strtok(line, ",");
-        if (token != NULL) {
-            data[rows].year = atoi(token);
-            years[rows] = data[rows].year;
-        }
-        
-        token = strtok(NULL, ",");
-        if (token != NULL) {
-            data[rows].percentage = atof(token);
+    int header_skipped = 0;
+    int eof = 0;
+    size_t filled = 0; // Sisa baris terpotong dari blok sebelumnya
+
+    while (!eof) {
+        // Baris lebih panjang dari buffer: perbesar buffer
+        if (filled == buffer_size) {
+            char* bigger = (char*)realloc(buffer, buffer_size * 2 + 1);
+            if (bigger == NULL) {
+                break;
+            }
+            buffer = bigger;
+            buffer_size *= 2;
         }
-        
-        token = strtok(NULL, ",");
-        if (token != NULL) {
-            data[rows].population = atof(token);
+
+        size_t wanted = buffer_size - filled;
+        size_t got = fread(buffer + filled, 1, wanted, file);
+        eof = (got < wanted);
+        filled += got;
+        buffer[filled] = '\0';
+
+        char* p = buffer;
+        char* limit = buffer + filled;
+        while (p < limit) {
+            char* newline = (char*)memchr(p, '\n', limit - p);
+            if (newline == NULL) {
+                if (!eof) {
+                    break; // Baris belum lengkap, lanjutkan di blok berikutnya
+                }
+                newline = limit;
+            }
+            *newline = '\0';
+
+            if (!header_skipped) {
+                // Lewati header
+                header_skipped = 1;
+            } else if (*p != '\0' && *p != '\r') {
+                if (rows == capacity) {
+                    int new_capacity = capacity * 2;
+                    DataRow* grown_data = (DataRow*)realloc(rows_data, new_capacity * sizeof(DataRow));
+                    if (grown_data != NULL) {
+                        rows_data = grown_data;
+                    }
+                    int* grown_years = (int*)realloc(rows_years, new_capacity * sizeof(int));
+                    if (grown_years != NULL) {
+                        rows_years = grown_years;
+                    }
+                    if (grown_data == NULL || grown_years == NULL) {
+                        printf("Error: Memori tidak cukup, pembacaan berhenti pada baris %d\n", rows);
+                        eof = 1;
+                        break;
+                    }
+                    capacity = new_capacity;
+                }
+                parseCSVLine(p, &rows_data[rows]);
+                rows_years[rows] = rows_data[rows].year;
+                rows++;
+            }
+            p = newline + 1;
         }
-        
-        rows++;
+
+        // Pindahkan sisa baris yang terpotong ke awal buffer
+        filled = (p < limit) ? (size_t)(limit - p) : 0;
+        memmove(buffer, p, filled);
     }
-    
+
+    free(buffer);
     fclose(file);
+
+    *data = rows_data;
+    *years = rows_years;
     return rows;
 }
 
@@ -241,12 +321,14 @@ void normalizeYears(int original_years[], double normalized_years[], int n, int
 }
 
 int main() {
-    DataRow data[MAX_ROWS];
-    int years[MAX_YEARS];
-    int rows = readCSV("Data Tugas Pemrograman A.csv", data, years);
+    DataRow* data;
+    int* years;
+    int rows = readCSV("Data Tugas Pemrograman A.csv", &data, &years);
     
     if (rows == 0) {
         printf("Error: Tidak ada data yang dibaca!\n");
+        free(data);
+        free(years);
         return 1;
     }
     
@@ -259,16 +341,16 @@ int main() {
     qsort(data, rows, sizeof(DataRow), compareDataRows);
     
     // Menyiapkan array untuk regresi persentase pengguna internet
-    int original_years_internet[MAX_ROWS];
-    double normalized_years_internet[MAX_ROWS];
-    double percentages[MAX_ROWS];
+    int* original_years_internet = (int*)malloc(rows * sizeof(int));
+    double* normalized_years_internet = (double*)malloc(rows * sizeof(double));
+    double* percentages = (double*)malloc(rows * sizeof(double));
     int n_internet = 0;
     int base_year = 2000; // Tahun dasar untuk normalisasi
     
     // Menyiapkan array untuk regresi populasi
-    int original_years_population[MAX_ROWS];
-    double normalized_years_population[MAX_ROWS];
-    double populations[MAX_ROWS];
+    int* original_years_population = (int*)malloc(rows * sizeof(int));
+    double* normalized_years_population = (double*)malloc(rows * sizeof(double));
+    double* populations = (double*)malloc(rows * sizeof(double));
     int n_population = 0;
     
     // Filter data setelah tahun 2000 untuk persentase internet
@@ -333,7 +415,7 @@ int main() {
     printf("%-6s %-25s %-15s\n", "Tahun", "Persentase Pengguna Internet", "Populasi");
     
     // Tambahkan data yang hilang ke dataset
-    DataRow new_data[MAX_ROWS + MISSING_YEARS];
+    DataRow* new_data = (DataRow*)malloc((rows + MISSING_YEARS) * sizeof(DataRow));
     int new_rows = 0;
     
     // Salin data yang ada ke dataset baru
@@ -373,6 +455,15 @@ int main() {
     printf("\nData lengkap telah disimpan ke file 'Data_Lengkap_Hasil_Polinomial.csv'\n");
     
     // Bersihkan memori
+    free(data);
+    free(years);
+    free(original_years_internet);
+    free(normalized_years_internet);
+    free(percentages);
+    free(original_years_population);
+    free(normalized_years_population);
+    free(populations);
+    free(new_data);
     free(coef_internet);
     free(coef_population);
     
@@ -1,328 +1,4153 @@
 /**
- * Program untuk melengkapi data yang hilang pada tahun 2005, 2006, 2015, dan 2016
+ * Program untuk melengkapi data yang hilang (tahun-tahun yang tidak ada di antara tahun
+ * pertama dan terakhir data, misalnya 2005, 2006, 2015, dan 2016)
  * menggunakan metode pencocokan kurva polinomial.
  * 
  * Metode ini menggunakan:
  * - Regresi polinomial untuk data persentase pengguna internet
  * - Regresi polinomial juga untuk data populasi
+ * - Regresi eksponensial (persentase) dan linear (populasi) dari mesin keluarga model yang sama,
+ *   disimpan ke Data_Lengkap_Hasil_Eksponensial.csv (pengganti program kodepemrogramana.c)
  * 
  * Termasuk prediksi untuk populasi Indonesia tahun 2030 dan pengguna internet tahun 2035.
+ * 
+ * Kompilasi: gcc -O2 kodepalingfinal.c -o kodepalingfinal -lm -lpthread
+ * Pemeriksaan mandiri jalur regresi alternatif (program terpisah, bukan bagian dari program utama):
+ *   gcc -O2 -DSELF_CHECK kodepalingfinal.c -o cek_kodepalingfinal -lm -lpthread && ./cek_kodepalingfinal
  */
 
-#include <stdio.h>
-#include <stdlib.h>
-#include <math.h>
-#include <string.h>
+#define _GNU_SOURCE // madvise, posix_memalign, dan sysconf tetap terdeklarasi di -std=c99/c11
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define MOMENTS_SIMD 1 // Kernel momen AVX2/AVX-512 dengan pemilihan saat runtime
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define INITIAL_ROWS 1024         // Kapasitas awal array data, digandakan saat penuh
+#define READ_CHUNK_SIZE (1 << 20) // Ukuran blok pembacaan file (1 MiB)
+#define WRITE_BUFFER_SIZE (1 << 20) // Ukuran buffer penulisan file (1 MiB)
+#define MAX_DEGREE 16 // Derajat maksimum untuk polinomial
+#define BATCH_CHUNK 64 // Jumlah deret per potongan kerja pada fit batch paralel
+#define REDUCTION_CHUNK (1 << 16) // Jumlah titik per potongan reduksi paralel satu deret
+#define MOMENT_COUNT(degree) (3 * (degree) + 3) // Σx^k (2d+1), Σy·x^k (d+1), lalu Σy²
+#define YEAR_MIN 1             // Tahun terkecil yang diterima dari file masukan
+#define YEAR_MAX 9999          // Tahun terbesar yang diterima dari file masukan
+#define MAX_YEAR_GAP 50        // Celah tahun terpanjang yang masih diisi dengan imputasi
+
+// Struktur untuk file yang dipetakan ke memori (read-only)
+typedef struct {
+    const char* data;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} MappedFile;
+
+// Fungsi untuk memetakan seluruh isi file ke memori. Mengembalikan 1 jika berhasil.
+int mapFile(const char* filename, MappedFile* mapped) {
+    mapped->data = NULL;
+    mapped->size = 0;
+#ifdef _WIN32
+    mapped->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                               OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    mapped->mapping = NULL;
+    if (mapped->file == INVALID_HANDLE_VALUE) {
+        return 0;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(mapped->file, &size)) {
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->size = (size_t)size.QuadPart;
+    if (mapped->size == 0) {
+        return 1;
+    }
+    mapped->mapping = CreateFileMappingA(mapped->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapped->mapping == NULL) {
+        CloseHandle(mapped->file);
+        return 0;
+    }
+    mapped->data = (const char*)MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (mapped->data == NULL) {
+        CloseHandle(mapped->mapping);
+        CloseHandle(mapped->file);
+        return 0;
+    }
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return 0;
+    }
+    mapped->size = (size_t)info.st_size;
+    if (mapped->size > 0) {
+        void* address = mmap(NULL, mapped->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            close(fd);
+            return 0;
+        }
+        madvise(address, mapped->size, MADV_SEQUENTIAL);
+        mapped->data = (const char*)address;
+    }
+    close(fd);
+#endif
+    return 1;
+}
+
+// Fungsi untuk melepas pemetaan file
+void unmapFile(MappedFile* mapped) {
+#ifdef _WIN32
+    if (mapped->data != NULL) UnmapViewOfFile(mapped->data);
+    if (mapped->mapping != NULL) CloseHandle(mapped->mapping);
+    CloseHandle(mapped->file);
+#else
+    if (mapped->data != NULL) munmap((void*)mapped->data, mapped->size);
+#endif
+    mapped->data = NULL;
+    mapped->size = 0;
+}
+
+#define VALID_PERCENTAGE 0x01 // Bit validitas: kolom persentase terisi
+#define VALID_POPULATION 0x02 // Bit validitas: kolom populasi terisi
+
+// Struktur dataset berorientasi kolom (SoA). Setiap kolom kontigu sehingga
+// regresi dapat membaca kolom secara langsung tanpa menyalin per baris.
+// valid[i] berisi bit VALID_* untuk nilai yang ada pada baris i.
+// Dataset hasil loadDatasetBinary bersifat read-only sampai pertama kali diubah.
+typedef struct {
+    int* year;
+    double* percentage;
+    double* population;
+    unsigned char* valid;
+    int rows;
+    int capacity;
+    MappedFile* mapping; // Tidak NULL jika kolom menunjuk langsung ke file biner yang dipetakan
+} Dataset;
+
+// Fungsi untuk menginisialisasi dataset kosong dengan kapasitas awal tertentu
+int initDataset(Dataset* dataset, int capacity) {
+    if (capacity < 1) capacity = 1;
+    dataset->year = (int*)malloc(capacity * sizeof(int));
+    dataset->percentage = (double*)malloc(capacity * sizeof(double));
+    dataset->population = (double*)malloc(capacity * sizeof(double));
+    dataset->valid = (unsigned char*)malloc(capacity * sizeof(unsigned char));
+    dataset->rows = 0;
+    dataset->capacity = capacity;
+    dataset->mapping = NULL;
+    if (dataset->year == NULL || dataset->percentage == NULL ||
+        dataset->population == NULL || dataset->valid == NULL) {
+        free(dataset->year);
+        free(dataset->percentage);
+        free(dataset->population);
+        free(dataset->valid);
+        dataset->year = NULL;
+        dataset->percentage = NULL;
+        dataset->population = NULL;
+        dataset->valid = NULL;
+        dataset->capacity = 0;
+        return 0;
+    }
+    return 1;
+}
+
+// Fungsi untuk membebaskan memori dataset
+void freeDataset(Dataset* dataset) {
+    if (dataset->mapping != NULL) {
+        unmapFile(dataset->mapping);
+        free(dataset->mapping);
+        dataset->mapping = NULL;
+    } else {
+        free(dataset->year);
+        free(dataset->percentage);
+        free(dataset->population);
+        free(dataset->valid);
+    }
+    dataset->year = NULL;
+    dataset->percentage = NULL;
+    dataset->population = NULL;
+    dataset->valid = NULL;
+    dataset->rows = 0;
+    dataset->capacity = 0;
+}
+
+// Fungsi untuk menyalin kolom dataset yang masih menunjuk ke file yang dipetakan
+// ke memori milik sendiri, sehingga dataset boleh diubah
+int detachDataset(Dataset* dataset, int capacity) {
+    if (dataset->mapping == NULL) {
+        return 1;
+    }
+    Dataset copy;
+    if (!initDataset(&copy, capacity > dataset->rows ? capacity : dataset->rows)) {
+        return 0;
+    }
+    int n = dataset->rows;
+    memcpy(copy.year, dataset->year, n * sizeof(int));
+    memcpy(copy.percentage, dataset->percentage, n * sizeof(double));
+    memcpy(copy.population, dataset->population, n * sizeof(double));
+    memcpy(copy.valid, dataset->valid, n * sizeof(unsigned char));
+    copy.rows = n;
+    freeDataset(dataset);
+    *dataset = copy;
+    return 1;
+}
+
+// Fungsi untuk memastikan kapasitas dataset minimal sebesar `needed` baris.
+// Kapasitas digandakan agar penambahan baris tetap O(1) teramortisasi.
+int reserveDataset(Dataset* dataset, int needed) {
+    if (needed <= dataset->capacity) {
+        return 1;
+    }
+    int capacity = dataset->capacity > 0 ? dataset->capacity : INITIAL_ROWS;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+    if (dataset->mapping != NULL) {
+        return detachDataset(dataset, capacity);
+    }
+
+    int* year = (int*)realloc(dataset->year, capacity * sizeof(int));
+    if (year == NULL) return 0;
+    dataset->year = year;
+    double* percentage = (double*)realloc(dataset->percentage, capacity * sizeof(double));
+    if (percentage == NULL) return 0;
+    dataset->percentage = percentage;
+    double* population = (double*)realloc(dataset->population, capacity * sizeof(double));
+    if (population == NULL) return 0;
+    dataset->population = population;
+    unsigned char* valid = (unsigned char*)realloc(dataset->valid, capacity * sizeof(unsigned char));
+    if (valid == NULL) return 0;
+    dataset->valid = valid;
+
+    dataset->capacity = capacity;
+    return 1;
+}
+
+// Fungsi untuk menambahkan satu baris lengkap ke dataset
+int appendDatasetRow(Dataset* dataset, int year, double percentage, double population) {
+    if (!reserveDataset(dataset, dataset->rows + 1)) {
+        return 0;
+    }
+    int i = dataset->rows++;
+    dataset->year[i] = year;
+    dataset->percentage[i] = percentage;
+    dataset->population[i] = population;
+    dataset->valid[i] = VALID_PERCENTAGE | VALID_POPULATION;
+    return 1;
+}
+
+// Pasangan (tahun, indeks baris) untuk pengurutan dataset kolom
+typedef struct {
+    int year;
+    int index;
+} YearIndex;
+
+// Fungsi untuk membandingkan dua YearIndex berdasarkan tahun (indeks sebagai penentu seri)
+int compareYearIndex(const void* a, const void* b) {
+    const YearIndex* ya = (const YearIndex*)a;
+    const YearIndex* yb = (const YearIndex*)b;
+    if (ya->year != yb->year) {
+        return (ya->year < yb->year) ? -1 : 1;
+    }
+    return ya->index - yb->index;
+}
+
+// Fungsi untuk mengurutkan seluruh kolom dataset berdasarkan tahun.
+// Data yang sudah terurut (kasus umum) hanya diperiksa dalam satu lintasan.
+int sortDatasetByYear(Dataset* dataset) {
+    int n = dataset->rows;
+    int sorted = 1;
+    for (int i = 1; i < n && sorted; i++) {
+        sorted = dataset->year[i - 1] <= dataset->year[i];
+    }
+    if (sorted) {
+        return 1;
+    }
+    if (!detachDataset(dataset, n)) {
+        return 0;
+    }
+
+    YearIndex* order = (YearIndex*)malloc(n * sizeof(YearIndex));
+    double* scratch = (double*)malloc(n * sizeof(double));
+    if (order == NULL || scratch == NULL) {
+        free(order);
+        free(scratch);
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        order[i].year = dataset->year[i];
+        order[i].index = i;
+    }
+    qsort(order, n, sizeof(YearIndex), compareYearIndex);
+
+    // Terapkan permutasi ke setiap kolom menggunakan satu buffer sementara
+    for (int i = 0; i < n; i++) scratch[i] = dataset->percentage[order[i].index];
+    memcpy(dataset->percentage, scratch, n * sizeof(double));
+    for (int i = 0; i < n; i++) scratch[i] = dataset->population[order[i].index];
+    memcpy(dataset->population, scratch, n * sizeof(double));
+    unsigned char* valid = (unsigned char*)scratch;
+    for (int i = 0; i < n; i++) valid[i] = dataset->valid[order[i].index];
+    memcpy(dataset->valid, valid, n * sizeof(unsigned char));
+    for (int i = 0; i < n; i++) dataset->year[i] = order[i].year;
+
+    free(order);
+    free(scratch);
+    return 1;
+}
+
+// Pangkat 10 yang dapat direpresentasikan tepat oleh double (10^0 .. 10^22)
+static const double exactPowersOf10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Fungsi untuk membaca bilangan bulat dari rentang [p, end) tanpa menyalin.
+// Mengembalikan posisi setelah angka, atau p jika tidak ada angka.
+const char* scanInt(const char* p, const char* end, int* out) {
+    const char* start = p;
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    const char* digits_start = p;
+    long long value = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (value < 100000000000LL) {
+            value = value * 10 + (*p - '0');
+        }
+        p++;
+    }
+
+    if (p == digits_start) {
+        *out = 0;
+        return start;
+    }
+
+    if (negative) {
+        value = -value;
+    }
+    if (value > 2147483647LL) value = 2147483647LL;
+    if (value < -2147483647LL - 1) value = -2147483647LL - 1;
+    *out = (int)value;
+    return p;
+}
+
+// Fungsi untuk membaca bilangan real dari rentang [p, end) tanpa menyalin dan tanpa locale.
+// Mantissa hingga 2^53 dengan eksponen |e| <= 22 dihitung langsung dengan satu perkalian
+// atau pembagian (hasilnya tepat sama dengan strtod); kasus lain diserahkan ke strtod.
+// Mengembalikan posisi setelah angka, atau p jika tidak ada angka.
+const char* scanDouble(const char* p, const char* end, double* out) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    const char* start = p;
+
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;  // Jumlah digit signifikan yang masuk ke mantissa
+    int exponent = 0;
+    int any_digit = 0;
+    int truncated = 0;
+
+    while (p < end && *p >= '0' && *p <= '9') {
+        any_digit = 1;
+        if (significant < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            if (mantissa != 0) {
+                significant++;
+            }
+        } else {
+            exponent++;
+            truncated |= (*p != '0');
+        }
+        p++;
+    }
+
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9') {
+            any_digit = 1;
+            if (significant < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                if (mantissa != 0) {
+                    significant++;
+                }
+                exponent--;
+            } else {
+                truncated |= (*p != '0');
+            }
+            p++;
+        }
+    }
+
+    if (!any_digit) {
+        *out = 0;
+        return start;
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        const char* exp_start = p;
+        p++;
+        int exp_negative = 0;
+        if (p < end && (*p == '-' || *p == '+')) {
+            exp_negative = (*p == '-');
+            p++;
+        }
+        if (p < end && *p >= '0' && *p <= '9') {
+            int exp_value = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                if (exp_value < 10000) {
+                    exp_value = exp_value * 10 + (*p - '0');
+                }
+                p++;
+            }
+            exponent += exp_negative ? -exp_value : exp_value;
+        } else {
+            p = exp_start; // 'e' tanpa angka bukan bagian dari bilangan
+        }
+    }
+
+    // Jalur cepat: hasil tepat karena mantissa dan 10^|e| sama-sama eksak
+    if (!truncated && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        double value = (double)mantissa;
+        if (exponent < 0) {
+            value /= exactPowersOf10[-exponent];
+        } else {
+            value *= exactPowersOf10[exponent];
+        }
+        *out = negative ? -value : value;
+        return p;
+    }
+
+    // Jalur lambat: salin token ke buffer kecil agar strtod membulatkan dengan benar
+    size_t length = (size_t)(p - start);
+    char local[64];
+    char* token = (length < sizeof(local)) ? local : (char*)malloc(length + 1);
+    if (token == NULL) {
+        *out = 0;
+        return p;
+    }
+    memcpy(token, start, length);
+    token[length] = '\0';
+    *out = strtod(token, NULL);
+    if (token != local) {
+        free(token);
+    }
+    return p;
+}
+
+// Fungsi untuk mengurai satu baris CSV "tahun,persentase,populasi" pada rentang [line, end)
+// ke baris `row` dataset. Kolom yang kosong bernilai 0 dan bit validitasnya tidak diset.
+// Baris dengan tahun di luar [YEAR_MIN, YEAR_MAX] (misalnya salah ketik 20190) disimpan tanpa
+// bit validitas sehingga tidak ikut regresi maupun pencarian tahun yang hilang.
+// Mengembalikan 0 jika baris tidak memiliki tahun (misalnya baris berisi spasi saja),
+// sehingga pemanggil tidak menyimpannya sebagai tahun 0.
+int parseCSVLine(const char* line, const char* end, Dataset* dataset, int row) {
+    const char* p = scanInt(line, end, &dataset->year[row]);
+    if (p == line) {
+        return 0;
+    }
+    double percentage = 0;
+    double population = 0;
+    unsigned char valid = 0;
+
+    if (p < end && *p == ',') {
+        const char* next = scanDouble(p + 1, end, &percentage);
+        if (next != p + 1) valid |= VALID_PERCENTAGE;
+        p = next;
+    }
+    if (p < end && *p == ',') {
+        const char* next = scanDouble(p + 1, end, &population);
+        if (next != p + 1) valid |= VALID_POPULATION;
+    }
+    if (dataset->year[row] < YEAR_MIN || dataset->year[row] > YEAR_MAX) {
+        valid = 0;
+    }
+
+    dataset->percentage[row] = percentage;
+    dataset->population[row] = population;
+    dataset->valid[row] = valid;
+    return 1;
+}
+
+// Fungsi untuk membaca data dari file CSV ke dataset kolom (tanpa batas jumlah baris).
+// File dibaca per blok READ_CHUNK_SIZE byte dan baris diurai langsung dari buffer,
+// sedangkan kapasitas kolom digandakan setiap kali penuh.
+// Dataset diinisialisasi di sini dan harus dibebaskan dengan freeDataset.
+int readCSV(const char* filename, Dataset* dataset) {
+    if (!initDataset(dataset, INITIAL_ROWS)) {
+        printf("Error: Memori tidak cukup untuk membaca file %s\n", filename);
+        return 0;
+    }
+
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL) {
+        printf("Error: Tidak dapat membuka file %s\n", filename);
+        return 0;
+    }
+
+    size_t buffer_size = READ_CHUNK_SIZE;
+    char* buffer = (char*)malloc(buffer_size + 1);
+    if (buffer == NULL) {
+        printf("Error: Memori tidak cukup untuk membaca file %s\n", filename);
+        fclose(file);
+        return 0;
+    }
+
+    int header_skipped = 0;
+    int eof = 0;
+    size_t filled = 0; // Sisa baris terpotong dari blok sebelumnya
+
+    while (!eof) {
+        // Baris lebih panjang dari buffer: perbesar buffer
+        if (filled == buffer_size) {
+            char* bigger = (char*)realloc(buffer, buffer_size * 2 + 1);
+            if (bigger == NULL) {
+                break;
+            }
+            buffer = bigger;
+            buffer_size *= 2;
+        }
+
+        size_t wanted = buffer_size - filled;
+        size_t got = fread(buffer + filled, 1, wanted, file);
+        eof = (got < wanted);
+        filled += got;
+        buffer[filled] = '\0';
+
+        char* p = buffer;
+        char* limit = buffer + filled;
+        while (p < limit) {
+            char* newline = (char*)memchr(p, '\n', limit - p);
+            if (newline == NULL) {
+                if (!eof) {
+                    break; // Baris belum lengkap, lanjutkan di blok berikutnya
+                }
+                newline = limit;
+            }
+            if (!header_skipped) {
+                // Lewati header
+                header_skipped = 1;
+            } else if (newline > p && *p != '\r') {
+                if (!reserveDataset(dataset, dataset->rows + 1)) {
+                    printf("Error: Memori tidak cukup, pembacaan berhenti pada baris %d\n", dataset->rows);
+                    eof = 1;
+                    break;
+                }
+                if (parseCSVLine(p, newline, dataset, dataset->rows)) {
+                    dataset->rows++;
+                }
+            }
+            p = newline + 1;
+        }
+
+        // Pindahkan sisa baris yang terpotong ke awal buffer
+        filled = (p < limit) ? (size_t)(limit - p) : 0;
+        memmove(buffer, p, filled);
+    }
+
+    free(buffer);
+    fclose(file);
+    return dataset->rows;
+}
+
+// Fungsi untuk membaca data dari file CSV ke dataset kolom melalui memory mapping.
+// Baris diurai langsung dari halaman yang dipetakan tanpa disalin ke buffer baris;
+// kolom dialokasikan sekali sesuai jumlah baris. Jika file tidak bisa dipetakan
+// (misalnya pipe), pembacaan dialihkan ke readCSV.
+int readCSVMapped(const char* filename, Dataset* dataset) {
+    MappedFile mapped;
+    if (!mapFile(filename, &mapped)) {
+        return readCSV(filename, dataset);
+    }
+
+    const char* p = mapped.data;
+    const char* limit = mapped.data + mapped.size;
+
+    // Lewati header
+    const char* newline = (p != NULL) ? (const char*)memchr(p, '\n', limit - p) : NULL;
+    p = (newline != NULL) ? newline + 1 : limit;
+
+    // Hitung batas atas jumlah baris agar alokasi cukup sekali
+    int capacity = 1;
+    for (const char* q = p; q < limit; q++) {
+        q = (const char*)memchr(q, '\n', limit - q);
+        if (q == NULL) {
+            break;
+        }
+        capacity++;
+    }
+
+    if (!initDataset(dataset, capacity)) {
+        printf("Error: Memori tidak cukup untuk membaca file %s\n", filename);
+        unmapFile(&mapped);
+        return 0;
+    }
+
+    while (p < limit) {
+        newline = (const char*)memchr(p, '\n', limit - p);
+        const char* line_end = (newline != NULL) ? newline : limit;
+        if (line_end > p && *p != '\r') {
+            if (parseCSVLine(p, line_end, dataset, dataset->rows)) {
+                dataset->rows++;
+            }
+        }
+        p = line_end + 1;
+    }
+
+    unmapFile(&mapped);
+    return dataset->rows;
+}
+
+// Buffer keluaran untuk menulis file dalam blok besar, bukan fprintf per baris
+typedef struct {
+    FILE* file;
+    char* data;
+    size_t used;
+    size_t size;
+    int failed;
+} OutputBuffer;
+
+// Fungsi untuk menulis isi buffer ke file
+void flushOutput(OutputBuffer* out) {
+    if (out->used > 0 && fwrite(out->data, 1, out->used, out->file) != out->used) {
+        out->failed = 1;
+    }
+    out->used = 0;
+}
+
+// Fungsi untuk memastikan tersedia ruang minimal `bytes` byte di buffer
+char* reserveOutput(OutputBuffer* out, size_t bytes) {
+    if (out->size - out->used < bytes) {
+        flushOutput(out);
+    }
+    return out->data + out->used;
+}
+
+// Fungsi untuk menambahkan string ke buffer
+void appendText(OutputBuffer* out, const char* text, size_t length) {
+    memcpy(reserveOutput(out, length), text, length);
+    out->used += length;
+}
+
+// Fungsi untuk menambahkan bilangan bulat ke buffer (setara "%d")
+void appendInt(OutputBuffer* out, int value) {
+    char digits[12];
+    int count = 0;
+    unsigned int magnitude = (value < 0) ? 0u - (unsigned int)value : (unsigned int)value;
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    char* p = reserveOutput(out, 12);
+    if (value < 0) {
+        *p++ = '-';
+    }
+    while (count > 0) {
+        *p++ = digits[--count];
+    }
+    out->used = (size_t)(p - out->data);
+}
+
+// Fungsi untuk menambahkan bilangan real dengan `decimals` digit desimal (setara "%.<decimals>f").
+// Nilai dikalikan 10^decimals lalu dibulatkan ke bilangan bulat; jika hasil perkalian terlalu
+// dekat ke titik tengah pembulatan (atau nilainya terlalu besar, negatif nol, NaN/inf),
+// snprintf dipakai agar hasilnya tetap identik byte per byte dengan printf.
+void appendFixed(OutputBuffer* out, double value, int decimals) {
+    static const double scales[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+    static const uint64_t divisors[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+        10000000ULL, 100000000ULL, 1000000000ULL
+    };
+
+    if (decimals >= 0 && decimals <= 9) {
+        double scaled = fabs(value) * scales[decimals];
+        if (scaled < 9.0e15) {
+            double rounded = nearbyint(scaled);
+            double distance = fabs(fabs(scaled - rounded) - 0.5);
+            double tolerance = (scaled + 1.0) * 4.0 * 2.220446049250313e-16;
+            if (distance > tolerance && !(rounded == 0 && signbit(value))) {
+                uint64_t whole = (uint64_t)rounded;
+                uint64_t integer_part = whole / divisors[decimals];
+                uint64_t fraction = whole % divisors[decimals];
+
+                char digits[24];
+                int count = 0;
+                do {
+                    digits[count++] = (char)('0' + integer_part % 10);
+                    integer_part /= 10;
+                } while (integer_part > 0);
+
+                char* p = reserveOutput(out, 32);
+                if (value < 0) {
+                    *p++ = '-';
+                }
+                while (count > 0) {
+                    *p++ = digits[--count];
+                }
+                if (decimals > 0) {
+                    *p++ = '.';
+                    for (int i = decimals - 1; i >= 0; i--) {
+                        p[i] = (char)('0' + fraction % 10);
+                        fraction /= 10;
+                    }
+                    p += decimals;
+                }
+                out->used = (size_t)(p - out->data);
+                return;
+            }
+        }
+    }
+
+    // Jalur lambat untuk kasus yang tidak dapat dijamin oleh jalur cepat
+    char text[512];
+    int length = snprintf(text, sizeof(text), "%.*f", decimals, value);
+    if (length > 0) {
+        appendText(out, text, (size_t)length < sizeof(text) ? (size_t)length : sizeof(text) - 1);
+    }
+}
+
+// Fungsi untuk menulis dataset ke file CSV. Nilai yang tidak valid ditulis sebagai kolom kosong.
+// Baris diformat ke buffer WRITE_BUFFER_SIZE byte dan ditulis per blok; format angkanya
+// identik dengan "%d,%.6f,%.0f".
+void writeCSV(const char* filename, const Dataset* dataset) {
+    FILE* file = fopen(filename, "w");
+    if (file == NULL) {
+        printf("Error: Tidak dapat membuka file %s untuk ditulis\n", filename);
+        return;
+    }
+    
+    OutputBuffer out = {file, (char*)malloc(WRITE_BUFFER_SIZE), 0, WRITE_BUFFER_SIZE, 0};
+    if (out.data == NULL) {
+        printf("Error: Memori tidak cukup untuk menulis file %s\n", filename);
+        fclose(file);
+        return;
+    }
+    
+    // Tulis header
+    static const char header[] = "Year,Percentage_Internet_User,Population\n";
+    appendText(&out, header, sizeof(header) - 1);
+    
+    // Tulis data
+    for (int i = 0; i < dataset->rows; i++) {
+        appendInt(&out, dataset->year[i]);
+        appendText(&out, ",", 1);
+        if (dataset->valid[i] & VALID_PERCENTAGE) {
+            appendFixed(&out, dataset->percentage[i], 6);
+        }
+        appendText(&out, ",", 1);
+        if (dataset->valid[i] & VALID_POPULATION) {
+            appendFixed(&out, dataset->population[i], 0);
+        }
+        appendText(&out, "\n", 1);
+    }
+    
+    flushOutput(&out);
+    if (out.failed) {
+        printf("Error: Gagal menulis file %s\n", filename);
+    }
+    free(out.data);
+    fclose(file);
+}
+
+// Format biner dataset kolom (versi 1, little-endian):
+//   [BinaryHeader][padding][kolom year][padding][kolom percentage][padding][kolom population][padding][kolom valid]
+// Setiap kolom dimulai pada offset kelipatan DATASET_ALIGNMENT sehingga dapat dipakai langsung
+// dari memori hasil mmap. Checksum adalah FNV-1a 64-bit per kata 8 byte (sisa diproses per byte).
+#define DATASET_MAGIC "KMNDSET\0"
+#define DATASET_VERSION 1
+#define DATASET_COLUMNS 4
+#define DATASET_ALIGNMENT 64
+
+#define COLUMN_YEAR 0
+#define COLUMN_PERCENTAGE 1
+#define COLUMN_POPULATION 2
+#define COLUMN_VALID 3
+
+#define COLUMN_TYPE_INT32 1
+#define COLUMN_TYPE_FLOAT64 2
+#define COLUMN_TYPE_UINT8 3
+
+// Deskripsi satu kolom di dalam header file biner
+typedef struct {
+    uint32_t id;
+    uint32_t type;
+    uint64_t offset;
+    uint64_t bytes;
+    uint64_t checksum;
+} BinaryColumn;
+
+// Header file biner dataset
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t column_count;
+    uint64_t rows;
+    BinaryColumn columns[DATASET_COLUMNS];
+    uint64_t header_checksum; // Checksum seluruh field header sebelum field ini
+} BinaryHeader;
+
+// Fungsi untuk memeriksa apakah mesin menggunakan urutan byte little-endian
+int hostIsLittleEndian(void) {
+    const uint16_t probe = 1;
+    return *(const unsigned char*)&probe == 1;
+}
+
+// Fungsi untuk menghitung checksum FNV-1a 64-bit (per kata 8 byte) dari sebuah blok memori
+uint64_t checksum64(const void* data, size_t bytes) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t hash = 14695981039346656037ULL;
+    while (bytes >= 8) {
+        uint64_t word;
+        memcpy(&word, p, 8);
+        hash = (hash ^ word) * 1099511628211ULL;
+        p += 8;
+        bytes -= 8;
+    }
+    while (bytes > 0) {
+        hash = (hash ^ *p) * 1099511628211ULL;
+        p++;
+        bytes--;
+    }
+    return hash;
+}
+
+// Fungsi untuk membulatkan offset ke kelipatan DATASET_ALIGNMENT berikutnya
+uint64_t alignOffset(uint64_t offset) {
+    return (offset + DATASET_ALIGNMENT - 1) & ~(uint64_t)(DATASET_ALIGNMENT - 1);
+}
+
+// Fungsi untuk menulis dataset ke file biner kolom (pasangan dari writeCSV).
+// Data ditulis ke "<filename>.tmp" lalu diganti namanya menjadi filename, sehingga file lama
+// (yang mungkin masih dipetakan sebagai masukan) tidak pernah terpotong di tengah penulisan.
+// Mengembalikan 1 jika berhasil.
+int writeDatasetBinary(const char* filename, const Dataset* dataset) {
+    if (!hostIsLittleEndian()) {
+        printf("Error: Format biner hanya didukung pada mesin little-endian\n");
+        return 0;
+    }
+
+    const void* columns[DATASET_COLUMNS] = {
+        dataset->year, dataset->percentage, dataset->population, dataset->valid
+    };
+    const uint32_t types[DATASET_COLUMNS] = {
+        COLUMN_TYPE_INT32, COLUMN_TYPE_FLOAT64, COLUMN_TYPE_FLOAT64, COLUMN_TYPE_UINT8
+    };
+    const uint64_t widths[DATASET_COLUMNS] = {
+        sizeof(int32_t), sizeof(double), sizeof(double), sizeof(uint8_t)
+    };
+
+    BinaryHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DATASET_MAGIC, sizeof(header.magic));
+    header.version = DATASET_VERSION;
+    header.column_count = DATASET_COLUMNS;
+    header.rows = (uint64_t)dataset->rows;
+
+    uint64_t offset = alignOffset(sizeof(BinaryHeader));
+    for (int c = 0; c < DATASET_COLUMNS; c++) {
+        header.columns[c].id = (uint32_t)c;
+        header.columns[c].type = types[c];
+        header.columns[c].offset = offset;
+        header.columns[c].bytes = widths[c] * header.rows;
+        header.columns[c].checksum = checksum64(columns[c], (size_t)header.columns[c].bytes);
+        offset = alignOffset(offset + header.columns[c].bytes);
+    }
+    header.header_checksum = checksum64(&header, offsetof(BinaryHeader, header_checksum));
+
+    size_t name_length = strlen(filename);
+    char* temporary = (char*)malloc(name_length + sizeof(".tmp"));
+    if (temporary == NULL) {
+        printf("Error: Memori tidak cukup untuk menulis file %s\n", filename);
+        return 0;
+    }
+    memcpy(temporary, filename, name_length);
+    memcpy(temporary + name_length, ".tmp", sizeof(".tmp"));
+
+    FILE* file = fopen(temporary, "wb");
+    if (file == NULL) {
+        printf("Error: Tidak dapat membuka file %s untuk ditulis\n", temporary);
+        free(temporary);
+        return 0;
+    }
+
+    static const char padding[DATASET_ALIGNMENT] = {0};
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    uint64_t written = sizeof(header);
+    for (int c = 0; c < DATASET_COLUMNS && ok; c++) {
+        size_t gap = (size_t)(header.columns[c].offset - written);
+        ok = (gap == 0 || fwrite(padding, 1, gap, file) == gap);
+        if (ok && header.columns[c].bytes > 0) {
+            ok = fwrite(columns[c], 1, (size_t)header.columns[c].bytes, file) == header.columns[c].bytes;
+        }
+        written = header.columns[c].offset + header.columns[c].bytes;
+    }
+
+    if (fclose(file) != 0) {
+        ok = 0;
+    }
+#ifdef _WIN32
+    // rename di Windows tidak menimpa file yang sudah ada
+    if (ok) {
+        remove(filename);
+    }
+#endif
+    if (ok && rename(temporary, filename) != 0) {
+        ok = 0;
+    }
+    if (!ok) {
+        remove(temporary);
+        printf("Error: Gagal menulis file %s\n", filename);
+    }
+    free(temporary);
+    return ok;
+}
+
+// Fungsi untuk memuat dataset dari file biner kolom melalui memory mapping tanpa menyalin.
+// Kolom dataset menunjuk langsung ke halaman file; salinan baru dibuat hanya jika dataset
+// kemudian diubah. Jika verify bernilai 1, checksum setiap kolom diperiksa (O(n));
+// header selalu diperiksa. Mengembalikan jumlah baris, atau -1 jika file tidak valid.
+int loadDatasetBinary(const char* filename, Dataset* dataset, int verify) {
+    dataset->year = NULL;
+    dataset->percentage = NULL;
+    dataset->population = NULL;
+    dataset->valid = NULL;
+    dataset->rows = 0;
+    dataset->capacity = 0;
+    dataset->mapping = NULL;
+
+    if (!hostIsLittleEndian()) {
+        printf("Error: Format biner hanya didukung pada mesin little-endian\n");
+        return -1;
+    }
+
+    MappedFile* mapped = (MappedFile*)malloc(sizeof(MappedFile));
+    if (mapped == NULL || !mapFile(filename, mapped)) {
+        printf("Error: Tidak dapat membuka file %s\n", filename);
+        free(mapped);
+        return -1;
+    }
+
+    BinaryHeader header;
+    const char* problem = NULL;
+    if (mapped->size < sizeof(BinaryHeader)) {
+        problem = "file terlalu kecil";
+    } else {
+        memcpy(&header, mapped->data, sizeof(header));
+        if (memcmp(header.magic, DATASET_MAGIC, sizeof(header.magic)) != 0) {
+            problem = "bukan file dataset biner";
+        } else if (header.version != DATASET_VERSION) {
+            problem = "versi format tidak didukung";
+        } else if (header.header_checksum != checksum64(&header, offsetof(BinaryHeader, header_checksum))) {
+            problem = "checksum header tidak cocok";
+        } else if (header.column_count != DATASET_COLUMNS || header.rows > 2147483647ULL) {
+            problem = "header tidak valid";
+        }
+    }
+
+    const uint32_t types[DATASET_COLUMNS] = {
+        COLUMN_TYPE_INT32, COLUMN_TYPE_FLOAT64, COLUMN_TYPE_FLOAT64, COLUMN_TYPE_UINT8
+    };
+    const uint64_t widths[DATASET_COLUMNS] = {
+        sizeof(int32_t), sizeof(double), sizeof(double), sizeof(uint8_t)
+    };
+    for (int c = 0; c < DATASET_COLUMNS && problem == NULL; c++) {
+        const BinaryColumn* column = &header.columns[c];
+        if (column->id != (uint32_t)c || column->type != types[c] ||
+            column->bytes != widths[c] * header.rows ||
+            column->offset % DATASET_ALIGNMENT != 0 ||
+            column->offset > mapped->size || column->bytes > mapped->size - column->offset) {
+            problem = "deskripsi kolom tidak valid";
+        } else if (verify && column->checksum != checksum64(mapped->data + column->offset, (size_t)column->bytes)) {
+            problem = "checksum kolom tidak cocok";
+        }
+    }
+
+    if (problem != NULL) {
+        printf("Error: File %s tidak dapat dimuat (%s)\n", filename, problem);
+        unmapFile(mapped);
+        free(mapped);
+        return -1;
+    }
+
+    dataset->year = (int*)(mapped->data + header.columns[COLUMN_YEAR].offset);
+    dataset->percentage = (double*)(mapped->data + header.columns[COLUMN_PERCENTAGE].offset);
+    dataset->population = (double*)(mapped->data + header.columns[COLUMN_POPULATION].offset);
+    dataset->valid = (unsigned char*)(mapped->data + header.columns[COLUMN_VALID].offset);
+    dataset->rows = (int)header.rows;
+    dataset->capacity = (int)header.rows;
+    dataset->mapping = mapped;
+    return dataset->rows;
+}
+
+// Fungsi untuk membaca dataset dari file CSV atau file biner (dikenali dari magic number)
+int readDataset(const char* filename, Dataset* dataset) {
+    char magic[8] = {0};
+    FILE* file = fopen(filename, "rb");
+    if (file != NULL) {
+        size_t got = fread(magic, 1, sizeof(magic), file);
+        fclose(file);
+        if (got == sizeof(magic) && memcmp(magic, DATASET_MAGIC, sizeof(magic)) == 0) {
+            int rows = loadDatasetBinary(filename, dataset, 1);
+            return rows > 0 ? rows : 0;
+        }
+    }
+    return readCSVMapped(filename, dataset);
+}
+
+// Fungsi untuk menemukan tahun yang hilang di antara tahun pertama dan terakhir suatu deret
+// dalam satu lintasan. years harus terurut naik (duplikat diperbolehkan). Setiap selisih
+// lebih dari satu antara tahun berurutan menghasilkan tahun-tahun celahnya, sehingga
+// biayanya O(n + jumlah celah) tanpa pencarian per tahun. Celah yang lebih panjang dari
+// max_gap tahun tidak diisi (biasanya akibat tahun yang salah ketik) dan jumlahnya ditambahkan
+// ke *refused jika tidak NULL. Selisih dan jumlah dihitung dalam 64-bit sehingga tahun ekstrem
+// tidak menyebabkan overflow. Paling banyak `capacity` tahun ditulis ke missing; nilai kembalian
+// adalah jumlah seluruh tahun yang hilang, sehingga pemanggil dapat memanggil sekali dengan
+// capacity 0 untuk mengetahui ukuran buffer.
+int64_t findMissingYears(const int years[], int n, int max_gap, int missing[], int64_t capacity, int* refused) {
+    int64_t found = 0;
+    for (int i = 1; i < n; i++) {
+        int64_t gap = (int64_t)years[i] - years[i - 1] - 1;
+        if (gap <= 0) {
+            continue;
+        }
+        if (gap > max_gap) {
+            if (refused != NULL) {
+                (*refused)++;
+            }
+            continue;
+        }
+        for (int64_t k = 1; k <= gap; k++) {
+            if (found < capacity) {
+                missing[found] = (int)(years[i - 1] + k);
+            }
+            found++;
+        }
+    }
+    return found;
+}
+
+#define CACHE_LINE 64 // Ukuran cache line (byte) untuk perataan matriks
+
+// Matriks padat row-major dalam satu blok memori yang diratakan ke cache line.
+// Elemen (i, j) berada di data[i * stride + j]; stride dibulatkan ke kelipatan
+// cache line sehingga setiap baris dimulai pada cache line baru.
+typedef struct {
+    double* data;
+    int rows;
+    int cols;
+    int stride;
+} Matrix;
+
+#define MATRIX_AT(m, i, j) ((m).data[(size_t)(i) * (m).stride + (j)])
+
+// Fungsi untuk mengalokasikan memori yang diratakan ke cache line
+void* alignedAlloc(size_t bytes) {
+    if (bytes == 0) bytes = CACHE_LINE;
+#ifdef _WIN32
+    return _aligned_malloc(bytes, CACHE_LINE);
+#else
+    void* memory = NULL;
+    if (posix_memalign(&memory, CACHE_LINE, bytes) != 0) {
+        return NULL;
+    }
+    return memory;
+#endif
+}
+
+// Fungsi untuk membebaskan memori dari alignedAlloc
+void alignedFree(void* memory) {
+#ifdef _WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+// Blok memori arena; data dimulai tepat setelah header (satu cache line)
+typedef struct ArenaBlock {
+    struct ArenaBlock* previous;
+    size_t size;
+} ArenaBlock;
+
+#define ARENA_HEADER CACHE_LINE
+#define ARENA_MIN_BLOCK (64 * 1024)
+
+// Alokator bump untuk memori sementara per fit. Alokasi hanya menggeser penunjuk;
+// seluruh isi dilepas sekaligus dengan resetArena. Jika sebuah fit membutuhkan lebih
+// dari satu blok, blok-blok tersebut digabung menjadi satu saat reset sehingga fit
+// berikutnya dengan ukuran yang sama tidak memanggil malloc lagi.
+typedef struct {
+    ArenaBlock* block;
+    size_t used;   // Byte terpakai pada blok aktif
+    size_t total;  // Byte terpakai di semua blok sejak reset terakhir
+} Arena;
+
+// Fungsi untuk menginisialisasi arena kosong (blok pertama dibuat saat alokasi pertama)
+void initArena(Arena* arena) {
+    arena->block = NULL;
+    arena->used = 0;
+    arena->total = 0;
+}
+
+// Fungsi untuk membuat blok arena baru dengan kapasitas minimal `size` byte
+int pushArenaBlock(Arena* arena, size_t size) {
+    ArenaBlock* block = (ArenaBlock*)alignedAlloc(ARENA_HEADER + size);
+    if (block == NULL) {
+        return 0;
+    }
+    block->previous = arena->block;
+    block->size = size;
+    arena->block = block;
+    arena->used = 0;
+    return 1;
+}
+
+// Fungsi untuk mengalokasikan `bytes` byte dari arena (diratakan ke cache line)
+void* arenaAlloc(Arena* arena, size_t bytes) {
+    bytes = (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    if (arena->block == NULL || arena->used + bytes > arena->block->size) {
+        size_t size = ARENA_MIN_BLOCK;
+        if (arena->block != NULL && arena->block->size * 2 > size) {
+            size = arena->block->size * 2;
+        }
+        if (size < bytes) {
+            size = bytes;
+        }
+        if (!pushArenaBlock(arena, size)) {
+            return NULL;
+        }
+    }
+    void* memory = (char*)arena->block + ARENA_HEADER + arena->used;
+    arena->used += bytes;
+    arena->total += bytes;
+    return memory;
+}
+
+// Fungsi untuk melepas seluruh alokasi arena sekaligus
+void resetArena(Arena* arena) {
+    if (arena->block != NULL && arena->block->previous != NULL) {
+        // Gabungkan semua blok menjadi satu blok seukuran pemakaian puncak
+        size_t needed = arena->total;
+        while (arena->block != NULL) {
+            ArenaBlock* previous = arena->block->previous;
+            alignedFree(arena->block);
+            arena->block = previous;
+        }
+        pushArenaBlock(arena, needed > ARENA_MIN_BLOCK ? needed : ARENA_MIN_BLOCK);
+    }
+    arena->used = 0;
+    arena->total = 0;
+}
+
+// Fungsi untuk membebaskan seluruh blok arena
+void freeArena(Arena* arena) {
+    while (arena->block != NULL) {
+        ArenaBlock* previous = arena->block->previous;
+        alignedFree(arena->block);
+        arena->block = previous;
+    }
+    arena->used = 0;
+    arena->total = 0;
+}
+
+// Alokasi matriks (satu kali alokasi untuk seluruh elemen)
+Matrix allocateMatrix(int rows, int cols) {
+    Matrix matrix;
+    int per_line = CACHE_LINE / (int)sizeof(double);
+    matrix.rows = rows;
+    matrix.cols = cols;
+    matrix.stride = (cols + per_line - 1) / per_line * per_line;
+    matrix.data = (double*)alignedAlloc((size_t)rows * matrix.stride * sizeof(double));
+    return matrix;
+}
+
+// Dealokasi matriks
+void freeMatrix(Matrix* matrix) {
+    alignedFree(matrix->data);
+    matrix->data = NULL;
+}
+
+// Alokasi matriks dari arena (dilepas bersama arena, tidak perlu freeMatrix)
+Matrix arenaMatrix(Arena* arena, int rows, int cols) {
+    Matrix matrix;
+    int per_line = CACHE_LINE / (int)sizeof(double);
+    matrix.rows = rows;
+    matrix.cols = cols;
+    matrix.stride = (cols + per_line - 1) / per_line * per_line;
+    matrix.data = (double*)arenaAlloc(arena, (size_t)rows * matrix.stride * sizeof(double));
+    return matrix;
+}
+
+#define ILL_CONDITIONED_LIMIT 1e12 // Estimasi bilangan kondisi di atas batas ini dilaporkan
+
+// Status hasil penyelesaian sistem dan fungsi regresi. Fungsi-fungsi ini tidak pernah
+// menghentikan program, sehingga pemanggil (misalnya proses batch) dapat melewati atau
+// menurunkan model untuk deret yang bermasalah lalu melanjutkan ke deret berikutnya.
+typedef enum {
+    FIT_OK = 0,
+    FIT_ILL_CONDITIONED,     // Solusi tetap dihitung, tetapi bilangan kondisinya sangat besar
+    FIT_SINGULAR,            // Matriks singular, tidak ada solusi
+    FIT_INSUFFICIENT_POINTS, // Jumlah titik data tidak cukup untuk model yang diminta
+    FIT_INVALID_ARGUMENT,    // Parameter di luar batas (misalnya derajat > MAX_DEGREE)
+    FIT_OUT_OF_MEMORY,
+    FIT_NOT_CONVERGED        // Iterasi nonlinear mencapai batas tanpa konvergen
+} FitStatus;
+
+// Fungsi untuk mendapatkan keterangan status fit
+const char* fitStatusMessage(FitStatus status) {
+    switch (status) {
+        case FIT_OK: return "berhasil";
+        case FIT_ILL_CONDITIONED: return "matriks berkondisi buruk";
+        case FIT_SINGULAR: return "matriks singular, tidak dapat menyelesaikan sistem";
+        case FIT_INSUFFICIENT_POINTS: return "jumlah titik data tidak cukup";
+        case FIT_INVALID_ARGUMENT: return "parameter tidak valid";
+        case FIT_OUT_OF_MEMORY: return "memori tidak cukup";
+        case FIT_NOT_CONVERGED: return "iterasi tidak konvergen";
+    }
+    return "status tidak dikenal";
+}
+
+// Konteks fit: memori kerja yang dipakai ulang dari satu fit ke fit berikutnya.
+// Setelah fit pertama (pemanasan), fit dengan derajat yang sama tidak lagi memanggil malloc.
+// condition berisi estimasi bilangan kondisi dari fit terakhir.
+typedef struct {
+    Arena arena;
+    double condition;
+} FitContext;
+
+// Fungsi untuk menginisialisasi konteks fit
+void initFitContext(FitContext* context) {
+    initArena(&context->arena);
+    context->condition = 0;
+}
+
+// Fungsi untuk membebaskan konteks fit
+void freeFitContext(FitContext* context) {
+    freeArena(&context->arena);
+}
+
+// Eliminasi Gauss-Jordan untuk penyelesaian sistem persamaan linier.
+// Matriks augmented diambil dari arena milik pemanggil. *condition diisi estimasi kasar
+// bilangan kondisi (rasio pivot terbesar dan terkecil).
+FitStatus gaussJordan(Arena* arena, const Matrix* A, const double* B, double* X, int n, double* condition) {
+    // Matriks augmented [A|B]
+    Matrix augmented = arenaMatrix(arena, n, n + 1);
+    if (augmented.data == NULL) {
+        return FIT_OUT_OF_MEMORY;
+    }
+    double max_pivot = 0;
+    double min_pivot = HUGE_VAL;
+    
+    // Inisialisasi matriks augmented
+    for (int i = 0; i < n; i++) {
+        double* row = &MATRIX_AT(augmented, i, 0);
+        memcpy(row, &MATRIX_AT(*A, i, 0), n * sizeof(double));
+        row[n] = B[i];
+    }
+    
+    // Proses eliminasi
+    for (int i = 0; i < n; i++) {
+        // Cari pivot maksimum di kolom saat ini
+        int max_row = i;
+        for (int j = i + 1; j < n; j++) {
+            if (fabs(MATRIX_AT(augmented, j, i)) > fabs(MATRIX_AT(augmented, max_row, i))) {
+                max_row = j;
+            }
+        }
+        
+        double* pivot_row = &MATRIX_AT(augmented, i, 0);
+        
+        // Tukar baris jika perlu
+        if (max_row != i) {
+            double* other = &MATRIX_AT(augmented, max_row, 0);
+            for (int j = 0; j <= n; j++) {
+                double temp = pivot_row[j];
+                pivot_row[j] = other[j];
+                other[j] = temp;
+            }
+        }
+        
+        // Normalisasi baris pivot
+        double pivot = pivot_row[i];
+        if (fabs(pivot) < 1e-10) {
+            *condition = HUGE_VAL;
+            return FIT_SINGULAR;
+        }
+        if (fabs(pivot) > max_pivot) max_pivot = fabs(pivot);
+        if (fabs(pivot) < min_pivot) min_pivot = fabs(pivot);
+        
+        for (int j = 0; j <= n; j++) {
+            pivot_row[j] /= pivot;
+        }
+        
+        // Eliminasi baris lain
+        for (int j = 0; j < n; j++) {
+            if (j != i) {
+                double* row = &MATRIX_AT(augmented, j, 0);
+                double factor = row[i];
+                for (int k = 0; k <= n; k++) {
+                    row[k] -= factor * pivot_row[k];
+                }
+            }
+        }
+    }
+    
+    // Ambil solusi
+    for (int i = 0; i < n; i++) {
+        X[i] = MATRIX_AT(augmented, i, n);
+    }
+    
+    *condition = (n > 0) ? max_pivot / min_pivot : 1;
+    return (*condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
+}
+
+// Fungsi untuk menambahkan value ke sum dengan penjumlahan terkompensasi (TwoSum Knuth).
+// Galat pembulatan setiap penjumlahan dikumpulkan di compensation dan ditambahkan di akhir.
+void twoSum(double* sum, double* compensation, double value) {
+    double total = *sum + value;
+    double part = total - *sum;
+    *compensation += (*sum - (total - part)) + (value - part);
+    *sum = total;
+}
+
+// Kernel skalar untuk accumulateMoments (juga dipakai untuk sisa data kernel SIMD).
+// sums/comps berisi 2*degree+1 momen, degree+1 jumlah silang, lalu Σy² beserta kompensasinya.
+void accumulateMomentsScalar(const double x[], const double y[], int n, int degree, double sums[], double comps[]) {
+    int max_power = 2 * degree;
+    int squares = MOMENT_COUNT(degree) - 1;
+    double* cross_sums = sums + max_power + 1;
+    double* cross_comps = comps + max_power + 1;
+    for (int i = 0; i < n; i++) {
+        twoSum(&sums[squares], &comps[squares], y[i] * y[i]);
+        double power = 1;
+        for (int k = 0; k <= max_power; k++) {
+            twoSum(&sums[k], &comps[k], power);
+            if (k <= degree) {
+                twoSum(&cross_sums[k], &cross_comps[k], y[i] * power);
+            }
+            power *= x[i];
+        }
+    }
+}
+
+#ifdef MOMENTS_SIMD
+// Kernel AVX2: 4 titik per iterasi, setiap lajur memiliki jumlah dan kompensasi sendiri.
+// Mengembalikan jumlah titik yang telah diproses (kelipatan 4).
+__attribute__((target("avx2")))
+int accumulateMomentsAVX2(const double x[], const double y[], int n, int degree, double sums[], double comps[]) {
+    int count = MOMENT_COUNT(degree);
+    int max_power = 2 * degree;
+    int squares = count - 1;
+    __m256d lane_sums[MOMENT_COUNT(MAX_DEGREE)];
+    __m256d lane_comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < count; k++) {
+        lane_sums[k] = _mm256_setzero_pd();
+        lane_comps[k] = _mm256_setzero_pd();
+    }
+
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d xv = _mm256_loadu_pd(x + i);
+        __m256d yv = _mm256_loadu_pd(y + i);
+        __m256d square = _mm256_mul_pd(yv, yv);
+        __m256d square_total = _mm256_add_pd(lane_sums[squares], square);
+        __m256d square_part = _mm256_sub_pd(square_total, lane_sums[squares]);
+        lane_comps[squares] = _mm256_add_pd(lane_comps[squares],
+            _mm256_add_pd(_mm256_sub_pd(lane_sums[squares], _mm256_sub_pd(square_total, square_part)),
+                          _mm256_sub_pd(square, square_part)));
+        lane_sums[squares] = square_total;
+        __m256d power = _mm256_set1_pd(1.0);
+        for (int k = 0; k <= max_power; k++) {
+            __m256d total = _mm256_add_pd(lane_sums[k], power);
+            __m256d part = _mm256_sub_pd(total, lane_sums[k]);
+            __m256d error = _mm256_add_pd(_mm256_sub_pd(lane_sums[k], _mm256_sub_pd(total, part)),
+                                          _mm256_sub_pd(power, part));
+            lane_comps[k] = _mm256_add_pd(lane_comps[k], error);
+            lane_sums[k] = total;
+            if (k <= degree) {
+                int c = max_power + 1 + k;
+                __m256d value = _mm256_mul_pd(yv, power);
+                total = _mm256_add_pd(lane_sums[c], value);
+                part = _mm256_sub_pd(total, lane_sums[c]);
+                error = _mm256_add_pd(_mm256_sub_pd(lane_sums[c], _mm256_sub_pd(total, part)),
+                                      _mm256_sub_pd(value, part));
+                lane_comps[c] = _mm256_add_pd(lane_comps[c], error);
+                lane_sums[c] = total;
+            }
+            power = _mm256_mul_pd(power, xv);
+        }
+    }
+
+    // Gabungkan lajur-lajur ke jumlah skalar secara terkompensasi
+    for (int k = 0; k < count; k++) {
+        double lanes[4], lane_errors[4];
+        _mm256_storeu_pd(lanes, lane_sums[k]);
+        _mm256_storeu_pd(lane_errors, lane_comps[k]);
+        for (int l = 0; l < 4; l++) {
+            twoSum(&sums[k], &comps[k], lanes[l]);
+            comps[k] += lane_errors[l];
+        }
+    }
+    return i;
+}
+
+// Kernel AVX-512: sama dengan kernel AVX2 tetapi 8 titik per iterasi.
+__attribute__((target("avx512f")))
+int accumulateMomentsAVX512(const double x[], const double y[], int n, int degree, double sums[], double comps[]) {
+    int count = MOMENT_COUNT(degree);
+    int max_power = 2 * degree;
+    int squares = count - 1;
+    __m512d lane_sums[MOMENT_COUNT(MAX_DEGREE)];
+    __m512d lane_comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < count; k++) {
+        lane_sums[k] = _mm512_setzero_pd();
+        lane_comps[k] = _mm512_setzero_pd();
+    }
+
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d xv = _mm512_loadu_pd(x + i);
+        __m512d yv = _mm512_loadu_pd(y + i);
+        __m512d square = _mm512_mul_pd(yv, yv);
+        __m512d square_total = _mm512_add_pd(lane_sums[squares], square);
+        __m512d square_part = _mm512_sub_pd(square_total, lane_sums[squares]);
+        lane_comps[squares] = _mm512_add_pd(lane_comps[squares],
+            _mm512_add_pd(_mm512_sub_pd(lane_sums[squares], _mm512_sub_pd(square_total, square_part)),
+                          _mm512_sub_pd(square, square_part)));
+        lane_sums[squares] = square_total;
+        __m512d power = _mm512_set1_pd(1.0);
+        for (int k = 0; k <= max_power; k++) {
+            __m512d total = _mm512_add_pd(lane_sums[k], power);
+            __m512d part = _mm512_sub_pd(total, lane_sums[k]);
+            __m512d error = _mm512_add_pd(_mm512_sub_pd(lane_sums[k], _mm512_sub_pd(total, part)),
+                                          _mm512_sub_pd(power, part));
+            lane_comps[k] = _mm512_add_pd(lane_comps[k], error);
+            lane_sums[k] = total;
+            if (k <= degree) {
+                int c = max_power + 1 + k;
+                __m512d value = _mm512_mul_pd(yv, power);
+                total = _mm512_add_pd(lane_sums[c], value);
+                part = _mm512_sub_pd(total, lane_sums[c]);
+                error = _mm512_add_pd(_mm512_sub_pd(lane_sums[c], _mm512_sub_pd(total, part)),
+                                      _mm512_sub_pd(value, part));
+                lane_comps[c] = _mm512_add_pd(lane_comps[c], error);
+                lane_sums[c] = total;
+            }
+            power = _mm512_mul_pd(power, xv);
+        }
+    }
+
+    for (int k = 0; k < count; k++) {
+        double lanes[8], lane_errors[8];
+        _mm512_storeu_pd(lanes, lane_sums[k]);
+        _mm512_storeu_pd(lane_errors, lane_comps[k]);
+        for (int l = 0; l < 8; l++) {
+            twoSum(&sums[k], &comps[k], lanes[l]);
+            comps[k] += lane_errors[l];
+        }
+    }
+    return i;
+}
+#endif
+
+// Jenis kernel momen yang dipilih saat runtime
+#define MOMENT_KERNEL_SCALAR 0
+#define MOMENT_KERNEL_AVX2 1
+#define MOMENT_KERNEL_AVX512 2
+
+// Fungsi untuk memilih kernel momen terbaik yang didukung CPU (hasilnya disimpan)
+int selectMomentKernel(void) {
+    static int selected = -1;
+    if (selected < 0) {
+        int kernel = MOMENT_KERNEL_SCALAR;
+#ifdef MOMENTS_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            kernel = MOMENT_KERNEL_AVX512;
+        } else if (__builtin_cpu_supports("avx2")) {
+            kernel = MOMENT_KERNEL_AVX2;
+        }
+#endif
+        selected = kernel;
+    }
+    return selected;
+}
+
+// Fungsi untuk menyelesaikan sistem simetris definit positif A X = B dengan faktorisasi LDLᵀ
+// di tempat (tanpa matriks augmented, sekitar n³/6 operasi). Hanya segitiga bawah A yang dibaca;
+// setelah pemanggilan, segitiga bawah berisi L dan diagonal berisi D. Mengembalikan 0 jika
+// A ternyata tidak definit positif (pivot D terlalu kecil relatif terhadap diagonal aslinya),
+// dan pemanggil sebaiknya beralih ke eliminasi dengan pivoting. *condition diisi estimasi
+// kasar bilangan kondisi (rasio elemen D terbesar dan terkecil).
+int choleskySolve(Matrix* A, const double* B, double* X, int n, double* condition) {
+    double max_d = 0;
+    double min_d = HUGE_VAL;
+    for (int j = 0; j < n; j++) {
+        double* row_j = &MATRIX_AT(*A, j, 0);
+        double original = row_j[j];
+        
+        // d_j = a_jj - Σ l_jk² d_k
+        double d = original;
+        for (int k = 0; k < j; k++) {
+            d -= row_j[k] * row_j[k] * MATRIX_AT(*A, k, k);
+        }
+        if (!(d > 1e-12 * fabs(original))) {
+            return 0;
+        }
+        row_j[j] = d;
+        if (d > max_d) max_d = d;
+        if (d < min_d) min_d = d;
+        
+        // l_ij = (a_ij - Σ l_ik l_jk d_k) / d_j untuk i > j
+        for (int i = j + 1; i < n; i++) {
+            double* row_i = &MATRIX_AT(*A, i, 0);
+            double sum = row_i[j];
+            for (int k = 0; k < j; k++) {
+                sum -= row_i[k] * row_j[k] * MATRIX_AT(*A, k, k);
+            }
+            row_i[j] = sum / d;
+        }
+    }
+    
+    // Substitusi maju L z = B, skala D, lalu substitusi mundur Lᵀ X = D⁻¹ z
+    for (int i = 0; i < n; i++) {
+        double sum = B[i];
+        for (int k = 0; k < i; k++) {
+            sum -= MATRIX_AT(*A, i, k) * X[k];
+        }
+        X[i] = sum;
+    }
+    for (int i = 0; i < n; i++) {
+        X[i] /= MATRIX_AT(*A, i, i);
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        double sum = X[i];
+        for (int k = i + 1; k < n; k++) {
+            sum -= MATRIX_AT(*A, k, i) * X[k];
+        }
+        X[i] = sum;
+    }
+    *condition = (n > 0) ? max_d / min_d : 1;
+    return 1;
+}
+
+// Fungsi untuk menambahkan momen data ke jumlah terkompensasi sums/comps (MOMENT_COUNT(degree)
+// elemen: 2*degree+1 momen Σx^k, degree+1 jumlah silang Σy·x^k, lalu Σy²) dengan kernel terbaik CPU.
+// Jumlah dan kompensasinya dipisah agar hasil beberapa potongan dapat digabung tanpa
+// kehilangan akurasi.
+void accumulateMomentsCompensated(const double x[], const double y[], int n, int degree, double sums[], double comps[]) {
+    int done = 0;
+#ifdef MOMENTS_SIMD
+    switch (selectMomentKernel()) {
+        case MOMENT_KERNEL_AVX512:
+            done = accumulateMomentsAVX512(x, y, n, degree, sums, comps);
+            break;
+        case MOMENT_KERNEL_AVX2:
+            done = accumulateMomentsAVX2(x, y, n, degree, sums, comps);
+            break;
+    }
+#endif
+    accumulateMomentsScalar(x + done, y + done, n - done, degree, sums, comps);
+}
+
+// Fungsi untuk menghitung jumlah momen data dalam satu lintasan tanpa pow:
+// moments[k] = Σ x^k untuk k = 0..2*degree dan cross[k] = Σ y·x^k untuk k = 0..degree.
+// Pangkat x diakumulasi dengan perkalian berulang sehingga biayanya O(n·degree).
+// Semua jumlahan memakai penjumlahan terkompensasi agar akurasi tetap terjaga untuk
+// nilai besar (misalnya populasi ~10^8) yang dipangkatkan, baik di jalur skalar maupun SIMD.
+// Derajat tidak boleh melebihi MAX_DEGREE.
+void accumulateMoments(const double x[], const double y[], int n, int degree, double moments[], double cross[]) {
+    int count = MOMENT_COUNT(degree);
+    double sums[MOMENT_COUNT(MAX_DEGREE)];
+    double comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < count; k++) {
+        sums[k] = 0;
+        comps[k] = 0;
+    }
+
+    accumulateMomentsCompensated(x, y, n, degree, sums, comps);
+
+    for (int k = 0; k <= 2 * degree; k++) {
+        moments[k] = sums[k] + comps[k];
+    }
+    for (int k = 0; k <= degree; k++) {
+        cross[k] = sums[2 * degree + 1 + k] + comps[2 * degree + 1 + k];
+    }
+}
+
+// Fungsi untuk menyelesaikan persamaan normal polinomial dari jumlah momennya.
+// A adalah matriks kerja (degree+1)x(degree+1) milik pemanggil; isinya ditimpa.
+// Matriks persamaan normal simetris definit positif sehingga diselesaikan dengan LDLᵀ.
+// Jika definit positif hilang (data hampir singular), A dibentuk ulang dari momen
+// dan diselesaikan dengan eliminasi Gauss-Jordan berpivot (memori augmented dari arena).
+FitStatus solveNormalEquations(Arena* arena, Matrix* A, const double moments[], const double cross[],
+                               int degree, double coef[], double* condition) {
+    for (int i = 0; i <= degree; i++) {
+        for (int j = 0; j <= degree; j++) {
+            MATRIX_AT(*A, i, j) = moments[i + j];
+        }
+    }
+    
+    if (choleskySolve(A, cross, coef, degree + 1, condition)) {
+        return (*condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
+    }
+    
+    for (int i = 0; i <= degree; i++) {
+        for (int j = 0; j <= degree; j++) {
+            MATRIX_AT(*A, i, j) = moments[i + j];
+        }
+    }
+    return gaussJordan(arena, A, cross, coef, degree + 1, condition);
+}
+
+// Fungsi untuk melakukan regresi polinomial.
+// Seluruh memori kerja diambil dari arena konteks dan dilepas di akhir fit.
+// Estimasi bilangan kondisi persamaan normal disimpan di context->condition.
+FitStatus polynomialRegression(FitContext* context, const double x[], const double y[], int n, double coef[], int degree) {
+    context->condition = 0;
+    if (degree < 0 || degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (n <= degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    
+    // Membuat matriks normal equations
+    Matrix A = arenaMatrix(arena, degree + 1, degree + 1);
+    double* B = (double*)arenaAlloc(arena, (degree + 1) * sizeof(double));
+    double* moments = (double*)arenaAlloc(arena, (2 * degree + 1) * sizeof(double));
+    if (A.data == NULL || B == NULL || moments == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    
+    // Hitung Σx^k (k <= 2*degree) dan Σy·x^k sekali; A[i][j] = Σx^(i+j) berbentuk Hankel
+    accumulateMoments(x, y, n, degree, moments, B);
+    FitStatus status = solveNormalEquations(arena, &A, moments, B, degree, coef, &context->condition);
+    
+    // Lepas memori kerja (blok arena tetap disimpan untuk fit berikutnya)
+    resetArena(arena);
+    return status;
+}
+
+// Satu deret data independen (misalnya satu provinsi atau kabupaten) untuk fit batch
+typedef struct {
+    const double* x;
+    const double* y;
+    int n;
+} Series;
+
+// Hasil fit satu deret dalam batch
+typedef struct {
+    FitStatus status;
+    double condition;
+    double coef[MAX_DEGREE + 1];
+} SeriesFit;
+
+// Fungsi untuk melakukan regresi polinomial berderajat sama pada banyak deret sekaligus.
+// Tahap 1 membaca data setiap deret tepat satu kali dan menulis jumlah momennya ke satu
+// tabel kontigu (3*degree+2 double per deret); tahap 2 menyelesaikan sistem kecil setiap
+// deret dari tabel tersebut dengan satu matriks kerja bersama. Deret yang gagal hanya
+// ditandai statusnya di results[i] tanpa menghentikan batch.
+// Mengembalikan jumlah deret yang berhasil (FIT_OK atau FIT_ILL_CONDITIONED).
+int fitPolynomialBatch(FitContext* context, const Series series[], int count, int degree, SeriesFit results[]) {
+    if (degree < 0 || degree > MAX_DEGREE) {
+        for (int s = 0; s < count; s++) {
+            results[s].status = FIT_INVALID_ARGUMENT;
+            results[s].condition = 0;
+        }
+        return 0;
+    }
+    
+    Arena* arena = &context->arena;
+    int stride = 3 * degree + 2;
+    double* table = (double*)arenaAlloc(arena, (size_t)count * stride * sizeof(double));
+    Matrix A = arenaMatrix(arena, degree + 1, degree + 1);
+    if (table == NULL || A.data == NULL) {
+        for (int s = 0; s < count; s++) {
+            results[s].status = FIT_OUT_OF_MEMORY;
+            results[s].condition = 0;
+        }
+        resetArena(arena);
+        return 0;
+    }
+    
+    // Tahap 1: satu lintasan data per deret ke tabel momen kontigu
+    for (int s = 0; s < count; s++) {
+        double* moments = table + (size_t)s * stride;
+        accumulateMoments(series[s].x, series[s].y, series[s].n, degree, moments, moments + 2 * degree + 1);
+    }
+    
+    // Tahap 2: selesaikan sistem (degree+1)x(degree+1) untuk setiap deret
+    int fitted = 0;
+    for (int s = 0; s < count; s++) {
+        const double* moments = table + (size_t)s * stride;
+        results[s].condition = 0;
+        if (series[s].n <= degree) {
+            results[s].status = FIT_INSUFFICIENT_POINTS;
+            continue;
+        }
+        results[s].status = solveNormalEquations(arena, &A, moments, moments + 2 * degree + 1,
+                                                 degree, results[s].coef, &results[s].condition);
+        if (results[s].status <= FIT_ILL_CONDITIONED) {
+            fitted++;
+        }
+    }
+    
+    resetArena(arena);
+    return fitted;
+}
+
+// Tugas paralel: memproses item [begin, end) dengan konteks fit milik thread pekerja
+typedef void (*ParallelTask)(void* job, FitContext* context, int begin, int end);
+
+// Status satu pekerja thread pool. Rentang item yang belum dikerjakan disimpan sebagai
+// pasangan (begin, end) 32-bit yang dipaket dalam satu atomik 64-bit: pemilik mengambil
+// potongan dari depan, pekerja lain mencuri separuh sisa dari belakang.
+typedef struct {
+    pthread_t thread;
+    _Atomic uint64_t range;
+    FitContext context;
+    int index;
+    struct ThreadPool* pool;
+} PoolWorker;
+
+// Thread pool dengan work stealing. Pemanggil runParallel ikut bekerja sebagai pekerja 0,
+// sehingga pool dengan `threads` pekerja hanya membuat threads-1 thread tambahan.
+// Setiap pekerja memiliki FitContext (arena) sendiri.
+typedef struct ThreadPool {
+    int threads;
+    PoolWorker* workers;
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    int generation;
+    int pending;
+    int stop;
+    ParallelTask task;
+    void* job;
+    int chunk;
+} ThreadPool;
+
+// Fungsi untuk mendapatkan jumlah inti CPU yang tersedia
+int availableCores(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+#endif
+}
+
+// Fungsi untuk memaket dan membongkar rentang (begin, end)
+uint64_t packRange(int begin, int end) {
+    return ((uint64_t)(uint32_t)begin << 32) | (uint32_t)end;
+}
+
+void unpackRange(uint64_t packed, int* begin, int* end) {
+    *begin = (int)(uint32_t)(packed >> 32);
+    *end = (int)(uint32_t)packed;
+}
+
+// Fungsi untuk mengambil potongan berikutnya dari depan rentang milik sendiri
+int takeFront(PoolWorker* worker, int chunk, int* begin, int* end) {
+    uint64_t packed = atomic_load(&worker->range);
+    for (;;) {
+        int b, e;
+        unpackRange(packed, &b, &e);
+        if (b >= e) {
+            return 0;
+        }
+        int next = (e - b > chunk) ? b + chunk : e;
+        if (atomic_compare_exchange_weak(&worker->range, &packed, packRange(next, e))) {
+            *begin = b;
+            *end = next;
+            return 1;
+        }
+    }
+}
+
+// Fungsi untuk mencuri separuh sisa rentang pekerja lain dari belakang
+int stealBack(PoolWorker* victim, int* begin, int* end) {
+    uint64_t packed = atomic_load(&victim->range);
+    for (;;) {
+        int b, e;
+        unpackRange(packed, &b, &e);
+        if (b >= e) {
+            return 0;
+        }
+        int half = (e - b + 1) / 2;
+        if (atomic_compare_exchange_weak(&victim->range, &packed, packRange(b, e - half))) {
+            *begin = e - half;
+            *end = e;
+            return 1;
+        }
+    }
+}
+
+// Fungsi untuk mengerjakan rentang milik sendiri lalu mencuri dari pekerja lain sampai habis
+void runWorker(ThreadPool* pool, PoolWorker* worker) {
+    int begin, end;
+    for (;;) {
+        if (takeFront(worker, pool->chunk, &begin, &end)) {
+            pool->task(pool->job, &worker->context, begin, end);
+            continue;
+        }
+        int stolen = 0;
+        for (int k = 1; k < pool->threads && !stolen; k++) {
+            PoolWorker* victim = &pool->workers[(worker->index + k) % pool->threads];
+            if (stealBack(victim, &begin, &end)) {
+                atomic_store(&worker->range, packRange(begin, end));
+                stolen = 1;
+            }
+        }
+        if (!stolen) {
+            return;
+        }
+    }
+}
+
+// Fungsi utama thread pekerja: menunggu generasi tugas baru lalu mengerjakannya
+void* poolWorkerMain(void* argument) {
+    PoolWorker* worker = (PoolWorker*)argument;
+    ThreadPool* pool = worker->pool;
+    int seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+        
+        runWorker(pool, worker);
+        
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// Fungsi untuk membuat thread pool; threads <= 0 berarti sebanyak inti CPU.
+// Mengembalikan jumlah pekerja, atau 0 jika gagal.
+int initThreadPool(ThreadPool* pool, int threads) {
+    if (threads <= 0) {
+        threads = availableCores();
+    }
+    pool->threads = threads;
+    pool->workers = (PoolWorker*)calloc(threads, sizeof(PoolWorker));
+    if (pool->workers == NULL) {
+        return 0;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->generation = 0;
+    pool->pending = 0;
+    pool->stop = 0;
+    
+    // Pilih kernel momen sebelum thread dibuat agar inisialisasinya tidak berlomba
+    selectMomentKernel();
+    
+    for (int w = 0; w < threads; w++) {
+        PoolWorker* worker = &pool->workers[w];
+        worker->index = w;
+        worker->pool = pool;
+        atomic_init(&worker->range, packRange(0, 0));
+        initFitContext(&worker->context);
+        if (w > 0 && pthread_create(&worker->thread, NULL, poolWorkerMain, worker) != 0) {
+            // Lanjutkan dengan pekerja yang sudah berhasil dibuat
+            freeFitContext(&worker->context);
+            pool->threads = w;
+            break;
+        }
+    }
+    return pool->threads;
+}
+
+// Fungsi untuk menghentikan dan membebaskan thread pool
+void freeThreadPool(ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (int w = 0; w < pool->threads; w++) {
+        if (w > 0) {
+            pthread_join(pool->workers[w].thread, NULL);
+        }
+        freeFitContext(&pool->workers[w].context);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->start);
+    pthread_cond_destroy(&pool->done);
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->threads = 0;
+}
+
+// Fungsi untuk menjalankan task pada item [0, count) secara paralel dengan potongan berukuran
+// `chunk`. Item dibagi rata ke semua pekerja lalu diseimbangkan dengan work stealing.
+// Fungsi kembali setelah semua item selesai dikerjakan.
+void runParallel(ThreadPool* pool, ParallelTask task, void* job, int count, int chunk) {
+    pool->task = task;
+    pool->job = job;
+    pool->chunk = chunk > 0 ? chunk : 1;
+    
+    int threads = pool->threads;
+    for (int w = 0; w < threads; w++) {
+        int begin = (int)((long long)count * w / threads);
+        int end = (int)((long long)count * (w + 1) / threads);
+        atomic_store(&pool->workers[w].range, packRange(begin, end));
+    }
+    
+    pthread_mutex_lock(&pool->lock);
+    pool->pending = threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    
+    runWorker(pool, &pool->workers[0]);
+    
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Data tugas fit batch paralel
+typedef struct {
+    const Series* series;
+    SeriesFit* results;
+    int degree;
+} BatchFitJob;
+
+// Task paralel: fit batch untuk deret [begin, end) dengan arena pekerja
+void batchFitTask(void* job, FitContext* context, int begin, int end) {
+    BatchFitJob* batch = (BatchFitJob*)job;
+    fitPolynomialBatch(context, batch->series + begin, end - begin, batch->degree, batch->results + begin);
+}
+
+// Fungsi untuk melakukan fit batch pada semua inti melalui thread pool.
+// Hasil deret ke-i selalu ditulis ke results[i], sehingga urutan dan isi keluaran sama
+// persis berapa pun jumlah thread. Mengembalikan jumlah deret yang berhasil.
+int fitPolynomialBatchParallel(ThreadPool* pool, const Series series[], int count, int degree, SeriesFit results[]) {
+    BatchFitJob job = {series, results, degree};
+    runParallel(pool, batchFitTask, &job, count, BATCH_CHUNK);
+    
+    int fitted = 0;
+    for (int s = 0; s < count; s++) {
+        if (results[s].status <= FIT_ILL_CONDITIONED) {
+            fitted++;
+        }
+    }
+    return fitted;
+}
+
+// Fungsi untuk mengevaluasi polinomial pada nilai x tertentu (metode Horner)
+double evaluatePolynomial(double x, const double coef[], int degree) {
+    double result = coef[degree];
+    for (int i = degree - 1; i >= 0; i--) {
+        result = result * x + coef[i];
+    }
+    return result;
+}
+
+#ifdef MOMENTS_SIMD
+// Kernel AVX2 untuk predictPolynomialBatch: Horner pada 4 titik sekaligus dengan urutan
+// operasi (kali lalu tambah, tanpa FMA) yang sama dengan evaluatePolynomial sehingga hasilnya
+// identik bit demi bit. Mengembalikan jumlah titik yang telah diproses (kelipatan 4).
+__attribute__((target("avx2")))
+int predictPolynomialAVX2(const double coef[], int degree, const double x[], int n, double out[],
+                          double lower, double upper) {
+    __m256d coefficients[MAX_DEGREE + 1];
+    for (int k = 0; k <= degree; k++) {
+        coefficients[k] = _mm256_set1_pd(coef[k]);
+    }
+    // max/min mengembalikan operan kedua jika ada NaN, sama seperti pemotongan skalar
+    __m256d low = _mm256_set1_pd(lower);
+    __m256d high = _mm256_set1_pd(upper);
+    
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d xv = _mm256_loadu_pd(x + i);
+        __m256d result = coefficients[degree];
+        for (int k = degree - 1; k >= 0; k--) {
+            result = _mm256_add_pd(_mm256_mul_pd(result, xv), coefficients[k]);
+        }
+        result = _mm256_max_pd(low, result);
+        result = _mm256_min_pd(high, result);
+        _mm256_storeu_pd(out + i, result);
+    }
+    return i;
+}
+
+// Kernel AVX-512 untuk predictPolynomialBatch: sama dengan kernel AVX2, 8 titik sekaligus.
+// Target avx512f juga mengizinkan FMA, sehingga kontraksi kali-tambah harus dicegah.
+__attribute__((target("avx512f")))
+int predictPolynomialAVX512(const double coef[], int degree, const double x[], int n, double out[],
+                            double lower, double upper) {
+    __m512d coefficients[MAX_DEGREE + 1];
+    for (int k = 0; k <= degree; k++) {
+        coefficients[k] = _mm512_set1_pd(coef[k]);
+    }
+    __m512d low = _mm512_set1_pd(lower);
+    __m512d high = _mm512_set1_pd(upper);
+    
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d xv = _mm512_loadu_pd(x + i);
+        __m512d result = coefficients[degree];
+        for (int k = degree - 1; k >= 0; k--) {
+            // Perkalian dengan mode pembulatan eksplisit agar tidak digabung menjadi FMA
+            result = _mm512_add_pd(_mm512_mul_round_pd(result, xv, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC),
+                                   coefficients[k]);
+        }
+        result = _mm512_max_pd(low, result);
+        result = _mm512_min_pd(high, result);
+        _mm512_storeu_pd(out + i, result);
+    }
+    return i;
+}
+#endif
+
+// Fungsi untuk mengevaluasi polinomial pada banyak titik sekaligus (misalnya grid prakiraan
+// bulanan) dan memotong hasilnya ke [lower, upper]; gunakan -HUGE_VAL/HUGE_VAL untuk tanpa batas.
+// Memakai kernel SIMD yang sama dipilih oleh selectMomentKernel, dan hasilnya identik dengan
+// evaluatePolynomial diikuti pemotongan skalar.
+void predictPolynomialBatch(const double coef[], int degree, const double x[], int n, double out[],
+                            double lower, double upper) {
+    int done = 0;
+#ifdef MOMENTS_SIMD
+    switch (selectMomentKernel()) {
+        case MOMENT_KERNEL_AVX512:
+            done = predictPolynomialAVX512(coef, degree, x, n, out, lower, upper);
+            break;
+        case MOMENT_KERNEL_AVX2:
+            done = predictPolynomialAVX2(coef, degree, x, n, out, lower, upper);
+            break;
+    }
+#endif
+    for (int i = done; i < n; i++) {
+        double value = evaluatePolynomial(x[i], coef, degree);
+        if (value < lower) value = lower;
+        if (value > upper) value = upper;
+        out[i] = value;
+    }
+}
+
+// Fungsi untuk normalisasi tahun (mengurangi dengan tahun dasar)
+void normalizeYears(const int original_years[], double normalized_years[], int n, int base_year) {
+    for (int i = 0; i < n; i++) {
+        normalized_years[i] = (double)original_years[i] - base_year;
+    }
+}
+
+// Fungsi untuk menghitung koefisien korelasi (R²)
+double calculateRSquared(const double x[], const double y[], int n, const double coef[], int degree) {
+    double mean_y = 0;
+    for (int i = 0; i < n; i++) {
+        mean_y += y[i];
+    }
+    mean_y /= n;
+    
+    double ss_total = 0;
+    double ss_residual = 0;
+    
+    for (int i = 0; i < n; i++) {
+        double y_pred = evaluatePolynomial(x[i], coef, degree);
+        double deviation = y[i] - mean_y;
+        double residual = y[i] - y_pred;
+        ss_total += deviation * deviation;
+        ss_residual += residual * residual;
+    }
+    
+    return 1 - (ss_residual / ss_total);
+}
+
+// Ukuran kualitas fit regresi
+typedef struct {
+    double r_squared;
+    double adjusted_r_squared; // NAN jika n <= degree + 1
+    double rmse;               // Akar rata-rata kuadrat residual
+} FitQuality;
+
+// Fungsi untuk menghitung ukuran kualitas fit langsung dari jumlah momen tanpa membaca data lagi.
+// Untuk solusi kuadrat terkecil: SSR = Σy² - 2·cᵀb + cᵀMc dan SST = Σy² - (Σy)²/n,
+// dengan M[i][j] = Σx^(i+j) dan b[k] = Σy·x^k. Karena SSR diperoleh dari selisih jumlah
+// besar, akurasinya menurun jika SSR sangat kecil dibanding Σy² (RMSE ≪ |y|·1e-6);
+// untuk kasus tersebut gunakan calculateRSquared dua lintasan.
+void fitQualityFromMoments(const double moments[], const double cross[], double sum_squares,
+                           const double coef[], int degree, FitQuality* quality) {
+    double n = moments[0];
+    double fitted = 0;   // cᵀb
+    double quadratic = 0; // cᵀMc
+    for (int i = 0; i <= degree; i++) {
+        fitted += coef[i] * cross[i];
+        double row = 0;
+        for (int j = 0; j <= degree; j++) {
+            row += moments[i + j] * coef[j];
+        }
+        quadratic += coef[i] * row;
+    }
+    
+    double ss_residual = sum_squares - 2 * fitted + quadratic;
+    double ss_total = sum_squares - cross[0] * cross[0] / n;
+    if (ss_residual < 0) ss_residual = 0;
+    if (ss_total < 0) ss_total = 0;
+    
+    quality->r_squared = 1 - (ss_residual / ss_total);
+    quality->adjusted_r_squared = (n > degree + 1)
+        ? 1 - (1 - quality->r_squared) * (n - 1) / (n - degree - 1)
+        : NAN;
+    quality->rmse = sqrt(ss_residual / n);
+}
+
+// Fungsi untuk melakukan regresi polinomial sekaligus menghitung R², R² terkoreksi dan RMSE
+// dalam satu lintasan data. Σy² diakumulasi bersama momen fit sehingga tidak perlu
+// calculateRSquared (dua lintasan tambahan). Kualitas hanya diisi jika fit berhasil.
+FitStatus polynomialRegressionWithQuality(FitContext* context, const double x[], const double y[], int n,
+                                          double coef[], int degree, FitQuality* quality) {
+    context->condition = 0;
+    if (degree < 0 || degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (n <= degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    int count = MOMENT_COUNT(degree);
+    double sums[MOMENT_COUNT(MAX_DEGREE)];
+    double comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < count; k++) {
+        sums[k] = 0;
+        comps[k] = 0;
+    }
+    accumulateMomentsCompensated(x, y, n, degree, sums, comps);
+    for (int k = 0; k < count; k++) {
+        sums[k] += comps[k];
+    }
+    
+    Matrix A = arenaMatrix(arena, degree + 1, degree + 1);
+    if (A.data == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    const double* moments = sums;
+    const double* cross = sums + 2 * degree + 1;
+    FitStatus status = solveNormalEquations(arena, &A, moments, cross, degree, coef, &context->condition);
+    if (status <= FIT_ILL_CONDITIONED) {
+        fitQualityFromMoments(moments, cross, sums[count - 1], coef, degree, quality);
+    }
+    
+    resetArena(arena);
+    return status;
+}
+
+// Kriteria pemilihan derajat polinomial
+typedef enum {
+    CRITERION_AIC, // Akaike: n·ln(SSR/n) + 2p
+    CRITERION_BIC  // Bayesian (Schwarz): n·ln(SSR/n) + p·ln(n), lebih menyukai model kecil
+} SelectionCriterion;
+
+// Fungsi untuk memilih derajat polinomial terbaik dari 1..max_degree berdasarkan AIC/BIC.
+// Momen hingga pangkat 2*max_degree dihitung sekali. Faktorisasi LDLᵀ matriks Hankel
+// bersifat bersarang: baris ke-d hanya bergantung pada baris sebelumnya, sehingga setiap
+// derajat cukup menambah satu baris L, satu elemen z = L⁻¹b dan memperbarui
+// SSR_d = SSR_(d-1) - z_d²/D_d tanpa menyelesaikan ulang sistem. Substitusi mundur hanya
+// dilakukan sekali untuk derajat terpilih. Pencarian berhenti pada derajat pertama yang
+// pivotnya runtuh (data tidak cukup untuk derajat lebih tinggi) atau yang membuat estimasi
+// kondisi max(D)/min(D) melebihi ILL_CONDITIONED_LIMIT, sehingga derajat terpilih selalu
+// berkondisi baik.
+// coef harus memuat max_degree+1 elemen; scores (boleh NULL) diisi nilai kriteria per derajat
+// (indeks 1..max_degree, NAN untuk derajat yang tidak dapat dievaluasi).
+FitStatus selectPolynomialDegree(FitContext* context, const double x[], const double y[], int n, int max_degree,
+                                 SelectionCriterion criterion, double coef[], int* best_degree, double scores[]) {
+    context->condition = 0;
+    *best_degree = 0;
+    if (max_degree < 1 || max_degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    for (int d = 0; d <= max_degree; d++) {
+        coef[d] = 0;
+        if (scores != NULL) {
+            scores[d] = NAN;
+        }
+    }
+    if (max_degree >= n - 1) {
+        max_degree = n - 2;
+    }
+    if (max_degree < 1) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    // Satu lintasan data untuk semua derajat
+    int count = MOMENT_COUNT(max_degree);
+    double sums[MOMENT_COUNT(MAX_DEGREE)];
+    double comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < count; k++) {
+        sums[k] = 0;
+        comps[k] = 0;
+    }
+    accumulateMomentsCompensated(x, y, n, max_degree, sums, comps);
+    for (int k = 0; k < count; k++) {
+        sums[k] += comps[k];
+    }
+    const double* moments = sums;
+    const double* cross = sums + 2 * max_degree + 1;
+    double sum_squares = sums[count - 1];
+    
+    Arena* arena = &context->arena;
+    Matrix L = arenaMatrix(arena, max_degree + 1, max_degree + 1);
+    double* D = (double*)arenaAlloc(arena, 2 * (max_degree + 1) * sizeof(double));
+    if (L.data == NULL || D == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    double* z = D + max_degree + 1;
+    
+    // SSR di bawah batas ini dianggap derau pembulatan agar ln(SSR) tetap terdefinisi
+    double ss_floor = 1e-15 * sum_squares + 1e-300;
+    double ss_residual = sum_squares;
+    double best_score = HUGE_VAL;
+    double max_d = 0;
+    double min_d = HUGE_VAL;
+    double best_condition = 0;
+    int fitted_degree = -1;
+    
+    for (int j = 0; j <= max_degree; j++) {
+        double* row_j = &MATRIX_AT(L, j, 0);
+        for (int k = 0; k < j; k++) {
+            const double* row_k = &MATRIX_AT(L, k, 0);
+            double sum = moments[j + k];
+            for (int m = 0; m < k; m++) {
+                sum -= row_j[m] * row_k[m] * D[m];
+            }
+            row_j[k] = sum / D[k];
+        }
+        double d = moments[2 * j];
+        double zj = cross[j];
+        for (int k = 0; k < j; k++) {
+            d -= row_j[k] * row_j[k] * D[k];
+            zj -= row_j[k] * z[k];
+        }
+        if (!(d > 1e-12 * moments[2 * j])) {
+            break;
+        }
+        double next_max = (d > max_d) ? d : max_d;
+        double next_min = (d < min_d) ? d : min_d;
+        if (next_max / next_min > ILL_CONDITIONED_LIMIT) {
+            break;
+        }
+        D[j] = d;
+        z[j] = zj;
+        max_d = next_max;
+        min_d = next_min;
+        fitted_degree = j;
+        
+        ss_residual -= zj * zj / d;
+        if (j == 0) {
+            continue;
+        }
+        double ss = (ss_residual > ss_floor) ? ss_residual : ss_floor;
+        double parameters = j + 1;
+        double penalty = (criterion == CRITERION_BIC) ? parameters * log((double)n) : 2 * parameters;
+        double score = n * log(ss / n) + penalty;
+        if (scores != NULL) {
+            scores[j] = score;
+        }
+        if (score < best_score) {
+            best_score = score;
+            *best_degree = j;
+            best_condition = max_d / min_d;
+        }
+    }
+    
+    if (fitted_degree < 1) {
+        resetArena(arena);
+        return FIT_SINGULAR;
+    }
+    
+    // Substitusi mundur Lᵀ c = D⁻¹ z pada blok depan derajat terpilih
+    int degree = *best_degree;
+    for (int i = degree; i >= 0; i--) {
+        double sum = z[i] / D[i];
+        for (int k = i + 1; k <= degree; k++) {
+            sum -= MATRIX_AT(L, k, i) * coef[k];
+        }
+        coef[i] = sum;
+    }
+    
+    context->condition = best_condition;
+    resetArena(arena);
+    return (best_condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
+}
+
+// Fungsi untuk menghitung galat validasi silang leave-one-out (LOOCV) secara eksak dari satu fit.
+// Residual LOO titik i adalah e_i / (1 - h_ii) dengan leverage h_ii = φᵢᵀ M⁻¹ φᵢ, φᵢ = (1, xᵢ, ..., xᵢ^d).
+// Dengan faktor LDLᵀ dari M, h_ii = Σ w_k² / D_k untuk w = L⁻¹φᵢ sehingga biayanya O(n·d²)
+// alih-alih n kali fit ulang. *rmse diisi akar rata-rata kuadrat residual LOO; residuals
+// (boleh NULL) diisi residual LOO per titik. Mengembalikan FIT_SINGULAR jika matriks normal
+// tidak definit positif atau ada titik dengan leverage 1 (residual LOO tak terdefinisi).
+FitStatus leaveOneOutCV(FitContext* context, const double x[], const double y[], int n, int degree,
+                        double* rmse, double residuals[]) {
+    context->condition = 0;
+    if (degree < 0 || degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (n <= degree + 1) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    Matrix A = arenaMatrix(arena, degree + 1, degree + 1);
+    double* moments = (double*)arenaAlloc(arena, (3 * degree + 2) * sizeof(double));
+    double* coef = (double*)arenaAlloc(arena, 2 * (degree + 1) * sizeof(double));
+    if (A.data == NULL || moments == NULL || coef == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    double* cross = moments + 2 * degree + 1;
+    double* w = coef + degree + 1;
+    
+    accumulateMoments(x, y, n, degree, moments, cross);
+    for (int i = 0; i <= degree; i++) {
+        for (int j = 0; j <= degree; j++) {
+            MATRIX_AT(A, i, j) = moments[i + j];
+        }
+    }
+    if (!choleskySolve(&A, cross, coef, degree + 1, &context->condition)) {
+        resetArena(arena);
+        return FIT_SINGULAR;
+    }
+    
+    double press = 0; // Jumlah kuadrat residual LOO (statistik PRESS)
+    double compensation = 0;
+    for (int i = 0; i < n; i++) {
+        // w = L⁻¹φ dengan substitusi maju, pangkat x dibentuk berurutan
+        double power = 1;
+        double leverage = 0;
+        for (int k = 0; k <= degree; k++) {
+            double sum = power;
+            for (int m = 0; m < k; m++) {
+                sum -= MATRIX_AT(A, k, m) * w[m];
+            }
+            w[k] = sum;
+            leverage += sum * sum / MATRIX_AT(A, k, k);
+            power *= x[i];
+        }
+        if (!(1 - leverage > 1e-12)) {
+            resetArena(arena);
+            return FIT_SINGULAR;
+        }
+        double residual = (y[i] - evaluatePolynomial(x[i], coef, degree)) / (1 - leverage);
+        if (residuals != NULL) {
+            residuals[i] = residual;
+        }
+        twoSum(&press, &compensation, residual * residual);
+    }
+    *rmse = sqrt((press + compensation) / n);
+    
+    resetArena(arena);
+    return (context->condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
+}
+
+// Fungsi untuk menghitung galat validasi silang k-fold beberapa derajat sekaligus dengan
+// downdate jumlah momen. Data dibagi menjadi `folds` blok berurutan (cocok untuk deret waktu).
+// Momen setiap blok hingga max_degree dihitung dalam satu lintasan; model derajat d pada
+// fold f diselesaikan dari momen total dikurangi momen blok f (memakai awalan momen untuk
+// derajat d), dan galatnya pada blok f dihitung dari momen blok itu sendiri:
+// SSE_f = Σy² - 2·cᵀb_f + cᵀM_f c. Data tidak dibaca ulang untuk setiap fold maupun derajat.
+// rmse[d - min_degree] diisi akar rata-rata kuadrat galat seluruh fold dan
+// statuses[d - min_degree] status terburuk penyelesaian fold untuk derajat tersebut
+// (rmse NAN jika ada fold yang gagal). context->condition berisi kondisi terburuk.
+// total_moments (boleh NULL, MOMENT_COUNT(max_degree) elemen) diisi momen seluruh data
+// sehingga pemanggil dapat menyelesaikan fit penuh tanpa lintasan data tambahan.
+FitStatus kFoldCVRange(FitContext* context, const double x[], const double y[], int n, int min_degree, int max_degree,
+                       int folds, double rmse[], FitStatus statuses[], double total_moments[]) {
+    context->condition = 0;
+    if (min_degree < 0 || min_degree > max_degree || max_degree > MAX_DEGREE || folds < 2) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (folds > n || n - (n + folds - 1) / folds <= max_degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    int width = MOMENT_COUNT(max_degree);
+    double* table = (double*)arenaAlloc(arena, (size_t)(folds + 1) * width * sizeof(double));
+    double* coef = (double*)arenaAlloc(arena, (max_degree + 1) * sizeof(double));
+    Matrix A = arenaMatrix(arena, max_degree + 1, max_degree + 1);
+    if (table == NULL || coef == NULL || A.data == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    
+    // Satu lintasan: momen per blok, baris terakhir tabel untuk momen total
+    double* total = table + (size_t)folds * width;
+    double total_comps[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < width; k++) {
+        total[k] = 0;
+        total_comps[k] = 0;
+    }
+    for (int f = 0; f < folds; f++) {
+        int begin = (int)((long long)n * f / folds);
+        int end = (int)((long long)n * (f + 1) / folds);
+        double* fold = table + (size_t)f * width;
+        double comps[MOMENT_COUNT(MAX_DEGREE)];
+        for (int k = 0; k < width; k++) {
+            fold[k] = 0;
+            comps[k] = 0;
+        }
+        accumulateMomentsCompensated(x + begin, y + begin, end - begin, max_degree, fold, comps);
+        for (int k = 0; k < width; k++) {
+            twoSum(&total[k], &total_comps[k], fold[k]);
+            total_comps[k] += comps[k];
+            fold[k] += comps[k];
+        }
+    }
+    for (int k = 0; k < width; k++) {
+        total[k] += total_comps[k];
+        if (total_moments != NULL) {
+            total_moments[k] = total[k];
+        }
+    }
+    
+    // Matriks kerja untuk derajat lebih kecil memakai sudut kiri atas A
+    double training[MOMENT_COUNT(MAX_DEGREE)];
+    double worst_condition = 0;
+    for (int degree = min_degree; degree <= max_degree; degree++) {
+        Matrix block = A;
+        block.rows = degree + 1;
+        block.cols = degree + 1;
+        double sse = 0;
+        FitStatus result = FIT_OK;
+        for (int f = 0; f < folds && result <= FIT_ILL_CONDITIONED; f++) {
+            const double* fold = table + (size_t)f * width;
+            for (int k = 0; k < width; k++) {
+                training[k] = total[k] - fold[k];
+            }
+            double condition;
+            const double* cross = fold + 2 * max_degree + 1;
+            FitStatus status = solveNormalEquations(arena, &block, training, training + 2 * max_degree + 1,
+                                                    degree, coef, &condition);
+            if (status > result) {
+                result = status;
+            }
+            if (status >= FIT_SINGULAR) {
+                break;
+            }
+            if (condition > worst_condition) {
+                worst_condition = condition;
+            }
+            
+            // SSE blok dari momennya: Σy² - 2cᵀb + cᵀMc
+            double fold_sse = fold[width - 1];
+            for (int i = 0; i <= degree; i++) {
+                double row = 0;
+                for (int j = 0; j <= degree; j++) {
+                    row += fold[i + j] * coef[j];
+                }
+                fold_sse += coef[i] * (row - 2 * cross[i]);
+            }
+            sse += (fold_sse > 0) ? fold_sse : 0;
+        }
+        statuses[degree - min_degree] = result;
+        rmse[degree - min_degree] = (result <= FIT_ILL_CONDITIONED) ? sqrt(sse / n) : NAN;
+    }
+    context->condition = worst_condition;
+    
+    resetArena(arena);
+    return FIT_OK;
+}
+
+// Fungsi untuk menghitung galat validasi silang k-fold satu derajat (lihat kFoldCVRange).
+// *rmse diisi akar rata-rata kuadrat galat seluruh fold.
+FitStatus kFoldCV(FitContext* context, const double x[], const double y[], int n, int degree, int folds, double* rmse) {
+    FitStatus status;
+    FitStatus result = kFoldCVRange(context, x, y, n, degree, degree, folds, rmse, &status, NULL);
+    return (result == FIT_OK) ? status : result;
+}
+
+// Data tugas reduksi momen paralel. Potongan ke-c mencakup titik
+// [c*REDUCTION_CHUNK, (c+1)*REDUCTION_CHUNK) dan hasil parsialnya ditulis ke slot c,
+// sehingga hasil akhir tidak bergantung pada jumlah thread maupun urutan pengerjaan.
+typedef struct {
+    const double* x;
+    const double* y;
+    int n;
+    int degree;
+    double* partials; // Per potongan: width jumlah lalu width kompensasi
+} MomentReductionJob;
+
+// Task paralel: jumlah momen terkompensasi untuk potongan [begin, end)
+void momentReductionTask(void* job, FitContext* context, int begin, int end) {
+    (void)context;
+    MomentReductionJob* reduction = (MomentReductionJob*)job;
+    int width = MOMENT_COUNT(reduction->degree);
+    for (int c = begin; c < end; c++) {
+        int start = c * REDUCTION_CHUNK;
+        int length = (reduction->n - start < REDUCTION_CHUNK) ? reduction->n - start : REDUCTION_CHUNK;
+        double* sums = reduction->partials + (size_t)c * 2 * width;
+        double* comps = sums + width;
+        for (int k = 0; k < width; k++) {
+            sums[k] = 0;
+            comps[k] = 0;
+        }
+        accumulateMomentsCompensated(reduction->x + start, reduction->y + start, length,
+                                     reduction->degree, sums, comps);
+    }
+}
+
+// Fungsi untuk menggabungkan hasil parsial secara berpasangan (pohon biner):
+// slot c digabung dengan slot c+step untuk step = 1, 2, 4, ... sehingga hasil akhir
+// berada di slot 0. Jumlah digabung dengan TwoSum, kompensasi dijumlahkan.
+void mergeMomentPartials(double* partials, int chunks, int width) {
+    for (int step = 1; step < chunks; step *= 2) {
+        for (int c = 0; c + step < chunks; c += 2 * step) {
+            double* sums = partials + (size_t)c * 2 * width;
+            double* comps = sums + width;
+            const double* other_sums = partials + (size_t)(c + step) * 2 * width;
+            const double* other_comps = other_sums + width;
+            for (int k = 0; k < width; k++) {
+                twoSum(&sums[k], &comps[k], other_sums[k]);
+                comps[k] += other_comps[k];
+            }
+        }
+    }
+}
+
+// Fungsi untuk melakukan regresi polinomial pada satu deret sangat panjang secara paralel.
+// Deret dipotong per REDUCTION_CHUNK titik, jumlah momen setiap potongan dihitung oleh
+// thread pool, lalu digabung berpasangan sebelum persamaan normal diselesaikan.
+// Regresi linear adalah kasus degree = 1. Memori parsial diambil dari arena `context`
+// (jangan memakai konteks milik pekerja pool). Hasilnya deterministik untuk berapa pun thread.
+FitStatus polynomialRegressionParallel(FitContext* context, ThreadPool* pool, const double x[], const double y[],
+                                       int n, double coef[], int degree) {
+    context->condition = 0;
+    if (degree < 0 || degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (n <= degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    int width = MOMENT_COUNT(degree);
+    int chunks = (n + REDUCTION_CHUNK - 1) / REDUCTION_CHUNK;
+    double* partials = (double*)arenaAlloc(arena, (size_t)chunks * 2 * width * sizeof(double));
+    double* moments = (double*)arenaAlloc(arena, width * sizeof(double));
+    Matrix A = arenaMatrix(arena, degree + 1, degree + 1);
+    if (partials == NULL || moments == NULL || A.data == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    
+    MomentReductionJob job = {x, y, n, degree, partials};
+    runParallel(pool, momentReductionTask, &job, chunks, 1);
+    mergeMomentPartials(partials, chunks, width);
+    for (int k = 0; k < width; k++) {
+        moments[k] = partials[k] + partials[width + k];
+    }
+    
+    FitStatus status = solveNormalEquations(arena, &A, moments, moments + 2 * degree + 1,
+                                            degree, coef, &context->condition);
+    resetArena(arena);
+    return status;
+}
+
+// Statistik parsial R² untuk satu potongan: jumlah titik, rata-rata dan M2 (jumlah kuadrat
+// simpangan dari rata-rata potongan) untuk SST, serta jumlah kuadrat residual terkompensasi.
+typedef struct {
+    double count;
+    double mean;
+    double m2;
+    double ss_residual;
+    double ss_residual_comp;
+} RSquaredPartial;
+
+// Data tugas R² paralel
+typedef struct {
+    const double* x;
+    const double* y;
+    int n;
+    const double* coef;
+    int degree;
+    RSquaredPartial* partials;
+} RSquaredJob;
+
+// Task paralel: statistik R² untuk potongan [begin, end) dengan algoritma Welford
+void rSquaredTask(void* job, FitContext* context, int begin, int end) {
+    (void)context;
+    RSquaredJob* r2 = (RSquaredJob*)job;
+    for (int c = begin; c < end; c++) {
+        int start = c * REDUCTION_CHUNK;
+        int stop = (r2->n - start < REDUCTION_CHUNK) ? r2->n : start + REDUCTION_CHUNK;
+        RSquaredPartial partial = {0, 0, 0, 0, 0};
+        for (int i = start; i < stop; i++) {
+            double yi = r2->y[i];
+            partial.count += 1;
+            double delta = yi - partial.mean;
+            partial.mean += delta / partial.count;
+            partial.m2 += delta * (yi - partial.mean);
+            double residual = yi - evaluatePolynomial(r2->x[i], r2->coef, r2->degree);
+            twoSum(&partial.ss_residual, &partial.ss_residual_comp, residual * residual);
+        }
+        r2->partials[c] = partial;
+    }
+}
+
+// Fungsi untuk menghitung R² satu deret sangat panjang secara paralel. Rata-rata dan SST
+// setiap potongan digabung berpasangan dengan rumus Chan agar tetap akurat tanpa lintasan
+// kedua untuk rata-rata global.
+double calculateRSquaredParallel(FitContext* context, ThreadPool* pool, const double x[], const double y[],
+                                 int n, const double coef[], int degree) {
+    int chunks = (n + REDUCTION_CHUNK - 1) / REDUCTION_CHUNK;
+    RSquaredPartial* partials = (RSquaredPartial*)arenaAlloc(&context->arena, (size_t)chunks * sizeof(RSquaredPartial));
+    if (partials == NULL || n == 0) {
+        resetArena(&context->arena);
+        return NAN;
+    }
+    
+    RSquaredJob job = {x, y, n, coef, degree, partials};
+    runParallel(pool, rSquaredTask, &job, chunks, 1);
+    
+    for (int step = 1; step < chunks; step *= 2) {
+        for (int c = 0; c + step < chunks; c += 2 * step) {
+            RSquaredPartial* a = &partials[c];
+            const RSquaredPartial* b = &partials[c + step];
+            double count = a->count + b->count;
+            double delta = b->mean - a->mean;
+            a->m2 += b->m2 + delta * delta * a->count * b->count / count;
+            a->mean += delta * b->count / count;
+            a->count = count;
+            twoSum(&a->ss_residual, &a->ss_residual_comp, b->ss_residual);
+            a->ss_residual_comp += b->ss_residual_comp;
+        }
+    }
+    
+    double ss_total = partials[0].m2;
+    double ss_residual = partials[0].ss_residual + partials[0].ss_residual_comp;
+    resetArena(&context->arena);
+    return 1 - (ss_residual / ss_total);
+}
+
+// Model polinomial dalam basis ternormalisasi t = (x - center) / scale dengan t di [-1, 1].
+// Basis ini menjaga kondisi matriks tetap baik walaupun x berupa tahun mentah (~2000)
+// atau derajatnya tinggi, sehingga normalisasi base_year manual tidak diperlukan.
+typedef struct {
+    int degree;
+    double center;
+    double scale;
+    double coef[MAX_DEGREE + 1];
+} PolynomialModel;
+
+// Fungsi untuk mengevaluasi model polinomial ternormalisasi pada nilai x
+double evaluateModel(const PolynomialModel* model, double x) {
+    return evaluatePolynomial((x - model->center) / model->scale, model->coef, model->degree);
+}
+
+// Fungsi untuk melakukan regresi polinomial dengan dekomposisi QR Householder.
+// Matriks desain Vandermonde dibentuk langsung dalam basis t = (x - center) / scale lalu
+// difaktorkan tanpa membentuk persamaan normal, sehingga bilangan kondisi tidak dikuadratkan
+// dan derajat 6-10 pada deret panjang tetap stabil. Matriks desain disimpan per kolom
+// (satu baris Matrix per kolom desain) agar setiap refleksi Householder membaca memori kontigu.
+// Estimasi bilangan kondisi matriks desain (rasio |R_jj| terbesar dan terkecil) disimpan
+// di context->condition.
+FitStatus polynomialRegressionQR(FitContext* context, const double x[], const double y[], int n, int degree, PolynomialModel* model) {
+    context->condition = 0;
+    if (degree < 0 || degree > MAX_DEGREE) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    if (n <= degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    // Tentukan basis ternormalisasi dari rentang x
+    double min_x = x[0], max_x = x[0];
+    for (int i = 1; i < n; i++) {
+        if (x[i] < min_x) min_x = x[i];
+        if (x[i] > max_x) max_x = x[i];
+    }
+    model->degree = degree;
+    model->center = 0.5 * (min_x + max_x);
+    model->scale = (max_x > min_x) ? 0.5 * (max_x - min_x) : 1.0;
+    
+    Arena* arena = &context->arena;
+    int columns = degree + 1;
+    Matrix design = arenaMatrix(arena, columns, n);
+    double* rhs = (double*)arenaAlloc(arena, n * sizeof(double));
+    double* diagonal = (double*)arenaAlloc(arena, columns * sizeof(double));
+    if (design.data == NULL || rhs == NULL || diagonal == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    
+    // Bentuk matriks desain: kolom k berisi t^k
+    for (int i = 0; i < n; i++) {
+        double t = (x[i] - model->center) / model->scale;
+        double power = 1;
+        for (int k = 0; k < columns; k++) {
+            MATRIX_AT(design, k, i) = power;
+            power *= t;
+        }
+        rhs[i] = y[i];
+    }
+    
+    // Faktorisasi QR Householder; R disimpan di atas diagonal kolom dan di `diagonal`
+    int ok = 1;
+    double first_norm = 0;
+    for (int j = 0; j < columns && ok; j++) {
+        double* column = &MATRIX_AT(design, j, 0);
+        double norm = 0;
+        for (int i = j; i < n; i++) {
+            norm += column[i] * column[i];
+        }
+        norm = sqrt(norm);
+        if (j == 0) {
+            first_norm = norm;
+        }
+        if (norm <= 1e-13 * first_norm || norm == 0) {
+            ok = 0;
+            break;
+        }
+        
+        // Vektor Householder v = a - alpha*e_j disimpan di tempat kolom a
+        // dengan |v|^2 = 2*norm*(norm + |a_j|)
+        double alpha = (column[j] > 0) ? -norm : norm;
+        double v_norm2 = 2.0 * norm * (norm + fabs(column[j]));
+        column[j] -= alpha;
+        diagonal[j] = alpha;
+        
+        // Terapkan refleksi ke kolom-kolom berikutnya dan ke ruas kanan
+        for (int k = j + 1; k <= columns; k++) {
+            double* target = (k < columns) ? &MATRIX_AT(design, k, 0) : rhs;
+            double dot = 0;
+            for (int i = j; i < n; i++) {
+                dot += column[i] * target[i];
+            }
+            double factor = 2.0 * dot / v_norm2;
+            for (int i = j; i < n; i++) {
+                target[i] -= factor * column[i];
+            }
+        }
+    }
+    
+    if (!ok) {
+        context->condition = HUGE_VAL;
+        resetArena(arena);
+        return FIT_SINGULAR;
+    }
+    
+    double max_r = 0;
+    double min_r = HUGE_VAL;
+    for (int j = 0; j < columns; j++) {
+        if (fabs(diagonal[j]) > max_r) max_r = fabs(diagonal[j]);
+        if (fabs(diagonal[j]) < min_r) min_r = fabs(diagonal[j]);
+    }
+    context->condition = max_r / min_r;
+    
+    // Substitusi mundur R c = Q^T y
+    for (int j = columns - 1; j >= 0; j--) {
+        double sum = rhs[j];
+        for (int k = j + 1; k < columns; k++) {
+            sum -= MATRIX_AT(design, k, j) * model->coef[k];
+        }
+        model->coef[j] = sum / diagonal[j];
+    }
+    
+    resetArena(arena);
+    return (context->condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
+}
+
+// Fitter regresi polinomial jendela bergulir: menyimpan W titik terakhir dalam buffer
+// melingkar beserta jumlah momennya (terkompensasi). Setiap titik baru menambah suku
+// pangkatnya dan titik yang kedaluwarsa dikurangkan, lalu hanya sistem (d+1)x(d+1) yang
+// diselesaikan ulang, sehingga kerja per pembaruan tidak bergantung pada W.
+// Momen dihitung dalam basis t = (x - center) / scale milik model agar jendela yang jauh
+// dari nol (misalnya tahun mentah) tetap berkondisi baik; hasilnya ada di rolling->model.
+typedef struct {
+    int window;
+    int count;          // Jumlah titik di jendela (<= window)
+    int head;           // Posisi tulis berikutnya di buffer
+    int since_rebuild;  // Pembaruan sejak momen dihitung ulang dari buffer
+    double* x;          // Buffer melingkar x mentah
+    double* y;
+    double* t;          // Memori kerja x ternormalisasi saat momen dihitung ulang
+    double sums[MOMENT_COUNT(MAX_DEGREE)];
+    double comps[MOMENT_COUNT(MAX_DEGREE)];
+    double condition;
+    PolynomialModel model;
+    Matrix A;
+    FitContext context; // Memori kerja untuk jalur cadangan Gauss-Jordan
+} RollingFit;
+
+// Fungsi untuk menambahkan (sign = 1) atau mengurangkan (sign = -1) suku momen satu titik
+void adjustPointMoments(double x, double y, int degree, double sign, double sums[], double comps[]) {
+    int max_power = 2 * degree;
+    int squares = MOMENT_COUNT(degree) - 1;
+    double power = sign;
+    for (int k = 0; k <= max_power; k++) {
+        twoSum(&sums[k], &comps[k], power);
+        if (k <= degree) {
+            twoSum(&sums[max_power + 1 + k], &comps[max_power + 1 + k], y * power);
+        }
+        power *= x;
+    }
+    twoSum(&sums[squares], &comps[squares], sign * y * y);
+}
+
+// Fungsi untuk menginisialisasi fitter jendela bergulir dengan lebar window dan derajat degree
+int initRollingFit(RollingFit* rolling, int window, int degree) {
+    if (degree < 0 || degree > MAX_DEGREE || window <= degree) {
+        return 0;
+    }
+    rolling->window = window;
+    rolling->count = 0;
+    rolling->head = 0;
+    rolling->since_rebuild = 0;
+    rolling->condition = 0;
+    for (int k = 0; k < MOMENT_COUNT(MAX_DEGREE); k++) {
+        rolling->sums[k] = 0;
+        rolling->comps[k] = 0;
+    }
+    rolling->model.degree = degree;
+    rolling->model.center = 0;
+    rolling->model.scale = 1;
+    for (int k = 0; k <= MAX_DEGREE; k++) {
+        rolling->model.coef[k] = 0;
+    }
+    rolling->x = (double*)malloc(3 * (size_t)window * sizeof(double));
+    rolling->A = allocateMatrix(degree + 1, degree + 1);
+    initFitContext(&rolling->context);
+    if (rolling->x == NULL || rolling->A.data == NULL) {
+        free(rolling->x);
+        freeMatrix(&rolling->A);
+        freeFitContext(&rolling->context);
+        rolling->x = NULL;
+        rolling->y = NULL;
+        rolling->t = NULL;
+        return 0;
+    }
+    rolling->y = rolling->x + window;
+    rolling->t = rolling->y + window;
+    return 1;
+}
+
+// Fungsi untuk membebaskan memori fitter jendela bergulir
+void freeRollingFit(RollingFit* rolling) {
+    free(rolling->x);
+    freeMatrix(&rolling->A);
+    freeFitContext(&rolling->context);
+    rolling->x = NULL;
+    rolling->y = NULL;
+    rolling->t = NULL;
+}
+
+// Fungsi untuk menghitung ulang momen dari isi buffer dengan basis baru yang dipusatkan
+// pada rentang x jendela saat ini. Juga menghapus galat pembatalan yang menumpuk.
+void rebuildRollingMoments(RollingFit* rolling) {
+    int degree = rolling->model.degree;
+    double low = rolling->x[0];
+    double high = rolling->x[0];
+    for (int i = 1; i < rolling->count; i++) {
+        if (rolling->x[i] < low) low = rolling->x[i];
+        if (rolling->x[i] > high) high = rolling->x[i];
+    }
+    rolling->model.center = 0.5 * (low + high);
+    rolling->model.scale = (high > low) ? 0.5 * (high - low) : 1;
+    for (int i = 0; i < rolling->count; i++) {
+        rolling->t[i] = (rolling->x[i] - rolling->model.center) / rolling->model.scale;
+    }
+    
+    int count = MOMENT_COUNT(degree);
+    for (int k = 0; k < count; k++) {
+        rolling->sums[k] = 0;
+        rolling->comps[k] = 0;
+    }
+    accumulateMomentsCompensated(rolling->t, rolling->y, rolling->count, degree, rolling->sums, rolling->comps);
+    rolling->since_rebuild = 0;
+}
+
+// Fungsi untuk menambahkan observasi baru ke jendela dan menyelesaikan ulang modelnya.
+// Jika jendela penuh, titik tertua dikeluarkan. Momen dihitung ulang dari buffer (dengan
+// basis yang disesuaikan ke posisi jendela) setiap `window` pembaruan, serta selama
+// jendela baru terisi, sehingga biaya teramortisasi tetap O(d) per titik ditambah
+// penyelesaian sistem kecil. Model terbaru ada di rolling->model (lihat evaluateModel).
+FitStatus updateRollingFit(RollingFit* rolling, double x, double y) {
+    PolynomialModel* model = &rolling->model;
+    int degree = model->degree;
+    if (rolling->count == rolling->window) {
+        double expired = (rolling->x[rolling->head] - model->center) / model->scale;
+        adjustPointMoments(expired, rolling->y[rolling->head], degree, -1, rolling->sums, rolling->comps);
+    } else {
+        rolling->count++;
+    }
+    rolling->x[rolling->head] = x;
+    rolling->y[rolling->head] = y;
+    rolling->head = (rolling->head + 1 == rolling->window) ? 0 : rolling->head + 1;
+    
+    // Saat jendela belum penuh, basis dibentuk ulang setiap kali jumlah titik berlipat dua
+    int warming_up = rolling->count < rolling->window && (rolling->count & (rolling->count - 1)) == 0;
+    if (++rolling->since_rebuild >= rolling->window || warming_up) {
+        rebuildRollingMoments(rolling);
+    } else {
+        adjustPointMoments((x - model->center) / model->scale, y, degree, 1, rolling->sums, rolling->comps);
+    }
+    
+    rolling->condition = 0;
+    if (rolling->count <= degree) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    double moments[MOMENT_COUNT(MAX_DEGREE)];
+    for (int k = 0; k < 3 * degree + 2; k++) {
+        moments[k] = rolling->sums[k] + rolling->comps[k];
+    }
+    FitStatus status = solveNormalEquations(&rolling->context.arena, &rolling->A, moments, moments + 2 * degree + 1,
+                                            degree, model->coef, &rolling->condition);
+    resetArena(&rolling->context.arena);
+    return status;
+}
+
+#define RECURSIVE_INITIAL_COVARIANCE 1e8 // P awal = δI; prior lemah di sekitar koefisien nol
+
+// Estimator kuadrat terkecil rekursif (RLS) untuk data yang datang terus-menerus.
+// Setiap titik memperbarui koefisien dan matriks kovarians P dalam O(d²) dengan memori
+// tetap, tanpa menyimpan data. Faktor lupa λ (0 < λ <= 1) memberi bobot λ^k pada titik
+// berumur k sehingga model mengikuti tren terbaru; λ = 1 setara regresi biasa.
+// Model dihitung dalam basis t = (x - center) / scale yang ditetapkan saat inisialisasi.
+// Jika logarithmic tidak nol, yang dimodelkan adalah ln(y) (keluarga eksponensial
+// y = a·e^(b·x) untuk derajat 1, sama dengan exponentialRegression), dan titik y <= 0 ditolak.
+typedef struct {
+    int count;       // Jumlah titik yang sudah diproses
+    int logarithmic;
+    double forgetting;
+    double P[(MAX_DEGREE + 1) * (MAX_DEGREE + 1)];
+    PolynomialModel model;
+} RecursiveFit;
+
+// Fungsi untuk menginisialisasi estimator RLS
+FitStatus initRecursiveFit(RecursiveFit* fit, int degree, double forgetting, double center, double scale, int logarithmic) {
+    if (degree < 0 || degree > MAX_DEGREE || !(forgetting > 0 && forgetting <= 1) || !(scale != 0)) {
+        return FIT_INVALID_ARGUMENT;
+    }
+    int size = degree + 1;
+    fit->count = 0;
+    fit->logarithmic = logarithmic;
+    fit->forgetting = forgetting;
+    fit->model.degree = degree;
+    fit->model.center = center;
+    fit->model.scale = scale;
+    for (int i = 0; i < size; i++) {
+        fit->model.coef[i] = 0;
+        for (int j = 0; j < size; j++) {
+            fit->P[i * size + j] = (i == j) ? RECURSIVE_INITIAL_COVARIANCE : 0;
+        }
+    }
+    return FIT_OK;
+}
+
+// Fungsi untuk memperbarui estimator RLS dengan satu titik (x, y):
+// k = Pφ / (λ + φᵀPφ), θ += k·(y - θᵀφ), P = (P - k·(Pφ)ᵀ) / λ.
+// Hanya segitiga atas P yang dihitung lalu dicerminkan agar P tetap simetris.
+// Mengembalikan FIT_INSUFFICIENT_POINTS sampai titik yang diproses melebihi derajat.
+FitStatus updateRecursiveFit(RecursiveFit* fit, double x, double y) {
+    int degree = fit->model.degree;
+    int size = degree + 1;
+    if (fit->logarithmic) {
+        if (!(y > 0)) {
+            return FIT_INVALID_ARGUMENT;
+        }
+        y = log(y);
+    }
+    
+    double phi[MAX_DEGREE + 1];
+    double gain[MAX_DEGREE + 1]; // Pφ, lalu k
+    double t = (x - fit->model.center) / fit->model.scale;
+    double power = 1;
+    for (int i = 0; i < size; i++) {
+        phi[i] = power;
+        power *= t;
+    }
+    
+    double denominator = fit->forgetting;
+    double prediction = 0;
+    for (int i = 0; i < size; i++) {
+        double sum = 0;
+        for (int j = 0; j < size; j++) {
+            sum += fit->P[i * size + j] * phi[j];
+        }
+        gain[i] = sum;
+        denominator += phi[i] * sum;
+        prediction += fit->model.coef[i] * phi[i];
+    }
+    
+    double error = y - prediction;
+    double inverse_forgetting = 1 / fit->forgetting;
+    for (int i = 0; i < size; i++) {
+        for (int j = i; j < size; j++) {
+            double value = (fit->P[i * size + j] - gain[i] * gain[j] / denominator) * inverse_forgetting;
+            fit->P[i * size + j] = value;
+            fit->P[j * size + i] = value;
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        fit->model.coef[i] += gain[i] / denominator * error;
+    }
+    
+    fit->count++;
+    return (fit->count > degree) ? FIT_OK : FIT_INSUFFICIENT_POINTS;
+}
+
+// Fungsi untuk memprediksi y pada x dengan model RLS terbaru (dikembalikan ke skala asli
+// untuk keluarga eksponensial)
+double predictRecursiveFit(const RecursiveFit* fit, double x) {
+    double value = evaluateModel(&fit->model, x);
+    return fit->logarithmic ? exp(value) : value;
+}
+
+// Fungsi untuk melakukan regresi linear (y = a + b*x) sebagai polinomial derajat 1.
+// quality (boleh NULL) diisi R², R² terkoreksi dan RMSE dari lintasan yang sama.
+FitStatus linearRegression(FitContext* context, const double x[], const double y[], int n,
+                           double* a, double* b, FitQuality* quality) {
+    double coef[2];
+    FitQuality unused;
+    FitStatus status = polynomialRegressionWithQuality(context, x, y, n, coef, 1, quality != NULL ? quality : &unused);
+    if (status <= FIT_ILL_CONDITIONED) {
+        *a = coef[0];
+        *b = coef[1];
+    }
+    return status;
+}
+
+// Fungsi untuk melakukan regresi eksponensial (y = a * e^(b*x)) dengan regresi linear pada ln(y).
+// Titik dengan y <= 0 diabaikan. Jumlahan diakumulasi langsung tanpa array ln(y) sementara.
+FitStatus exponentialRegression(FitContext* context, const double x[], const double y[], int n, double* a, double* b) {
+    context->condition = 0;
+    double moments[3] = {0, 0, 0}; // Σ1, Σx, Σx² untuk titik y > 0
+    double cross[2] = {0, 0};      // Σln(y), Σx·ln(y)
+    for (int i = 0; i < n; i++) {
+        if (y[i] > 0) {
+            double ln_y = log(y[i]);
+            moments[0] += 1;
+            moments[1] += x[i];
+            moments[2] += x[i] * x[i];
+            cross[0] += ln_y;
+            cross[1] += x[i] * ln_y;
+        }
+    }
+    if (moments[0] < 2) {
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    
+    Arena* arena = &context->arena;
+    Matrix A = arenaMatrix(arena, 2, 2);
+    if (A.data == NULL) {
+        resetArena(arena);
+        return FIT_OUT_OF_MEMORY;
+    }
+    double coef[2];
+    FitStatus status = solveNormalEquations(arena, &A, moments, cross, 1, coef, &context->condition);
+    resetArena(arena);
+    if (status <= FIT_ILL_CONDITIONED) {
+        *a = exp(coef[0]);
+        *b = coef[1];
+    }
+    return status;
+}
+
+typedef struct ModelFamily ModelFamily;
+
+// Model hasil fit dari satu keluarga model. Parameter disimpan dalam array umum sehingga
+// semua keluarga dapat diprediksi, dinilai dan diserialisasi dengan antarmuka yang sama:
+// linear/polinomial: params[k] koefisien x^k; eksponensial: params = {a, b}.
+typedef struct {
+    const ModelFamily* family;
+    FitStatus status;
+    double condition;
+    int parameters;              // Jumlah parameter yang dipakai di params
+    double params[MAX_DEGREE + 1];
+    FitQuality quality;          // Dihitung pada skala y asli
+} FittedModel;
+
+// Antarmuka keluarga model. fit mengisi params, parameters, condition dan quality model;
+// predict mengevaluasi model pada banyak titik sekaligus; serialize menulis model sebagai
+// satu baris teks (kembalian seperti snprintf). Penilaian memakai scoreModel yang sama untuk
+// semua keluarga. degree dipakai oleh keluarga
+// polinomial (0 untuk keluarga dengan jumlah parameter tetap); level_limit adalah batas atas
+// nilai jenuh K keluarga pertumbuhan (0 berarti tanpa batas).
+struct ModelFamily {
+    const char* name;
+    int degree;
+    FitStatus (*fit)(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                     FittedModel* model);
+    void (*predict)(const FittedModel* model, const double x[], int n, double out[]);
+    int (*serialize)(const FittedModel* model, char* buffer, size_t size);
+    double level_limit;
+};
+
+#define SCORE_BLOCK 256 // Jumlah titik per blok prediksi saat menilai model
+
+// Fungsi untuk menilai model pada data (x, y) dalam satu lintasan: prediksi dihitung per blok
+// lewat predict keluarga model, SST dengan algoritma Welford dan SSR terkompensasi.
+void scoreModel(const FittedModel* model, const double x[], const double y[], int n, FitQuality* quality) {
+    double predicted[SCORE_BLOCK];
+    double count = 0, mean = 0, m2 = 0;
+    double ss_residual = 0, compensation = 0;
+    for (int begin = 0; begin < n; begin += SCORE_BLOCK) {
+        int length = (n - begin < SCORE_BLOCK) ? n - begin : SCORE_BLOCK;
+        model->family->predict(model, x + begin, length, predicted);
+        for (int i = 0; i < length; i++) {
+            double yi = y[begin + i];
+            count += 1;
+            double delta = yi - mean;
+            mean += delta / count;
+            m2 += delta * (yi - mean);
+            double residual = yi - predicted[i];
+            twoSum(&ss_residual, &compensation, residual * residual);
+        }
+    }
+    ss_residual += compensation;
+    
+    int p = model->parameters - 1;
+    quality->r_squared = 1 - (ss_residual / m2);
+    quality->adjusted_r_squared = (count > p + 1)
+        ? 1 - (1 - quality->r_squared) * (count - 1) / (count - p - 1)
+        : NAN;
+    quality->rmse = sqrt(ss_residual / count);
+}
+
+// Fungsi serialize bawaan: "<nama> <derajat> <jumlah> <param>..." dengan presisi penuh (%.17g)
+// sehingga parameter dapat dibaca ulang tanpa kehilangan bit. Mengembalikan panjang teks
+// seperti snprintf (teks terpotong jika >= size).
+int serializeModelParameters(const FittedModel* model, char* buffer, size_t size) {
+    int length = snprintf(buffer, size, "%s %d %d", model->family->name, model->family->degree, model->parameters);
+    for (int k = 0; k < model->parameters && length >= 0; k++) {
+        size_t used = ((size_t)length < size) ? (size_t)length : size;
+        int written = snprintf(buffer + used, size - used, " %.17g", model->params[k]);
+        length = (written < 0) ? -1 : length + written;
+    }
+    return length;
+}
+
+// Keluarga polinomial (termasuk linear sebagai derajat 1): fit dan kualitas dalam satu lintasan
+FitStatus fitPolynomialFamily(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                              FittedModel* model) {
+    model->parameters = family->degree + 1;
+    return polynomialRegressionWithQuality(context, x, y, n, model->params, family->degree, &model->quality);
+}
+
+// Prediksi keluarga polinomial dengan Horner SIMD
+void predictPolynomialFamily(const FittedModel* model, const double x[], int n, double out[]) {
+    predictPolynomialBatch(model->params, model->parameters - 1, x, n, out, -HUGE_VAL, HUGE_VAL);
+}
+
+// Keluarga eksponensial: fit pada ln(y), lalu kualitas dinilai pada skala y asli
+FitStatus fitExponentialFamily(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                               FittedModel* model) {
+    (void)family;
+    model->parameters = 2;
+    FitStatus status = exponentialRegression(context, x, y, n, &model->params[0], &model->params[1]);
+    if (status <= FIT_ILL_CONDITIONED) {
+        scoreModel(model, x, y, n, &model->quality);
+    }
+    return status;
+}
+
+// Prediksi keluarga eksponensial: y = a * e^(b*x)
+void predictExponentialFamily(const FittedModel* model, const double x[], int n, double out[]) {
+    double a = model->params[0];
+    double b = model->params[1];
+    for (int i = 0; i < n; i++) {
+        out[i] = b * x[i];
+    }
+    for (int i = 0; i < n; i++) {
+        out[i] = a * exp(out[i]);
+    }
+}
+
+// Keluarga linear: y = a + b*x lewat linearRegression, diprediksi sebagai polinomial derajat 1
+FitStatus fitLinearFamily(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                          FittedModel* model) {
+    (void)family;
+    model->parameters = 2;
+    return linearRegression(context, x, y, n, &model->params[0], &model->params[1], &model->quality);
+}
+
+// Fungsi untuk memeriksa apakah keluarga model berbentuk polinomial (termasuk linear)
+int isPolynomialFamily(const ModelFamily* family) {
+    return family->fit == fitPolynomialFamily || family->fit == fitLinearFamily;
+}
+
+const ModelFamily linearFamily = {"linear", 1, fitLinearFamily, predictPolynomialFamily, serializeModelParameters, 0};
+const ModelFamily exponentialFamily = {"eksponensial", 0, fitExponentialFamily, predictExponentialFamily, serializeModelParameters, 0};
+
+// Fungsi untuk membuat keluarga polinomial berderajat tertentu
+ModelFamily polynomialFamily(int degree) {
+    ModelFamily family = {"polinomial", degree, fitPolynomialFamily, predictPolynomialFamily, serializeModelParameters, 0};
+    return family;
+}
+
+// Fungsi untuk melakukan fit satu keluarga model
+FitStatus fitModel(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                   FittedModel* model) {
+    model->family = family;
+    model->parameters = 0;
+    model->quality.r_squared = NAN;
+    model->quality.adjusted_r_squared = NAN;
+    model->quality.rmse = NAN;
+    model->status = family->fit(family, context, x, y, n, model);
+    model->condition = context->condition;
+    return model->status;
+}
+
+// Fungsi untuk melakukan fit beberapa keluarga model pada data yang sama, berdampingan.
+// Data hanya dimuat sekali; setiap keluarga membaca array yang sama di memori.
+// Mengembalikan indeks model dengan R² terkoreksi tertinggi dalam sampel (-1 jika semua gagal);
+// ini hanya ringkasan kecocokan, model untuk imputasi dipilih runModelTournament (RMSE di luar sampel).
+int fitModels(const ModelFamily* const families[], int count, FitContext* context, const double x[], const double y[],
+              int n, FittedModel models[]) {
+    int best = -1;
+    for (int f = 0; f < count; f++) {
+        FitStatus status = fitModel(families[f], context, x, y, n, &models[f]);
+        if (status <= FIT_ILL_CONDITIONED &&
+            (best < 0 || models[f].quality.adjusted_r_squared > models[best].quality.adjusted_r_squared)) {
+            best = f;
+        }
+    }
+    return best;
+}
+
+// Fungsi untuk memprediksi model pada banyak titik dengan pemotongan ke [lower, upper]
+void predictModel(const FittedModel* model, const double x[], int n, double out[], double lower, double upper) {
+    model->family->predict(model, x, n, out);
+    for (int i = 0; i < n; i++) {
+        if (out[i] < lower) out[i] = lower;
+        if (out[i] > upper) out[i] = upper;
+    }
+}
+
+#define GROWTH_MAX_ITERATIONS 200   // Batas iterasi Levenberg-Marquardt
+#define GROWTH_TOLERANCE 1e-12      // Penurunan relatif SSE yang dianggap konvergen
+#define GROWTH_MAX_DAMPING 1e16     // Redaman maksimum sebelum iterasi dianggap berhenti di minimum
+#define GROWTH_SAMPLE_LIMIT 4096    // Jumlah titik maksimum yang dibaca Levenberg-Marquardt per iterasi
 
-#define MAX_ROWS 100
-#define MAX_YEARS 100
-#define MISSING_YEARS 4
-#define MAX_DEGREE 3  // Derajat maksimum untuk polinomial
+// Jenis kurva pertumbuhan jenuh dengan parameter {K, r, x0}:
+// logistik: y = K / (1 + e^(-r(x - x0))), titik belok di y = K/2;
+// Gompertz: y = K · e^(-e^(-r(x - x0))), titik belok di y = K/e.
+typedef enum {
+    GROWTH_LOGISTIC,
+    GROWTH_GOMPERTZ
+} GrowthCurve;
 
-// Struktur untuk menyimpan data dari file CSV
-typedef struct {
-    int year;
-    double percentage;
-    double population;
-} DataRow;
+// Fungsi untuk menghitung nilai kurva pertumbuhan dan turunan analitiknya terhadap
+// {K, r, x0} pada satu titik. Bentuk sigmoid dihitung stabil untuk eksponen besar.
+double evaluateGrowth(GrowthCurve curve, const double params[3], double x, double gradient[3]) {
+    double K = params[0], r = params[1], x0 = params[2];
+    double shifted = x - x0;
+    double z = r * shifted;
+    double value, slope; // slope = turunan value/K terhadap z
+    if (curve == GROWTH_LOGISTIC) {
+        double s;
+        if (z >= 0) {
+            s = 1 / (1 + exp(-z));
+        } else {
+            double e = exp(z);
+            s = e / (1 + e);
+        }
+        value = s;
+        slope = s * (1 - s);
+    } else {
+        double u = exp(-z);
+        double g = exp(-u);
+        value = g;
+        slope = (g > 0) ? u * g : 0;
+    }
+    if (gradient != NULL) {
+        gradient[0] = value;
+        gradient[1] = K * slope * shifted;
+        gradient[2] = -K * slope * r;
+    }
+    return K * value;
+}
 
-// Fungsi untuk membaca data dari file CSV
-int readCSV(const char* filename, DataRow data[], int* years) {
-    FILE* file = fopen(filename, "r");
-    if (file == NULL) {
-        printf("Error: Tidak dapat membuka file %s\n", filename);
-        return 0;
+// Fungsi untuk menghitung jumlah kuadrat residual kurva pertumbuhan pada data
+double growthResidualSquares(GrowthCurve curve, const double params[3], const double x[], const double y[], int n) {
+    double sse = 0, compensation = 0;
+    for (int i = 0; i < n; i++) {
+        double residual = y[i] - evaluateGrowth(curve, params, x[i], NULL);
+        twoSum(&sse, &compensation, residual * residual);
     }
+    return sse + compensation;
+}
 
-    char line[256];
-    int rows = 0;
+// Fungsi untuk melakukan fit kurva pertumbuhan jenuh (logistik/Gompertz) dengan
+// Levenberg-Marquardt dan Jacobian analitik, dengan titik awal dari exponentialRegression
+// pada bentuk linear kurva (lihat di bawah). Setiap iterasi membaca data
+// sekali untuk membentuk JᵀJ (3x3) dan Jᵀe, lalu menyelesaikan
+// (JᵀJ + λ·diag(JᵀJ)) δ = Jᵀe dengan LDLᵀ di stack; tidak ada alokasi per iterasi, sehingga
+// aman dipakai berulang pada ribuan deret. Deret yang lebih panjang dari GROWTH_SAMPLE_LIMIT
+// di-fit pada sampel berjarak tetap agar biaya per fit terbatas. Jika max_level > 0, K dijaga
+// tidak melebihi max_level (misalnya 100 untuk persentase): langkah diproyeksikan kembali ke
+// batas, dan selama K menempel di batas hanya {r, x0} yang diperbarui. params diisi {K, r, x0};
+// context->condition berisi estimasi kondisi JᵀJ pada solusi.
+FitStatus growthRegression(GrowthCurve curve, FitContext* context, const double x[], const double y[], int n,
+                           double max_level, double params[3]) {
+    if (n < 4) {
+        context->condition = 0;
+        return FIT_INSUFFICIENT_POINTS;
+    }
+    if (!(max_level > 0)) {
+        max_level = HUGE_VAL;
+    }
+    
+    // Sampel berjarak tetap untuk deret panjang (data terurut menurut x, sehingga sampel
+    // mencakup seluruh rentang); arena tidak dipakai karena exponentialRegression melepasnya
+    double* sample = NULL;
+    if (n > GROWTH_SAMPLE_LIMIT) {
+        sample = (double*)malloc(2 * GROWTH_SAMPLE_LIMIT * sizeof(double));
+        if (sample == NULL) {
+            context->condition = 0;
+            return FIT_OUT_OF_MEMORY;
+        }
+        int stride = (n + GROWTH_SAMPLE_LIMIT - 1) / GROWTH_SAMPLE_LIMIT;
+        int m = 0;
+        for (int i = 0; i < n; i += stride) {
+            sample[m] = x[i];
+            sample[GROWTH_SAMPLE_LIMIT + m] = y[i];
+            m++;
+        }
+        x = sample;
+        y = sample + GROWTH_SAMPLE_LIMIT;
+        n = m;
+    }
     
-    // Baca header
-    fgets(line, sizeof(line), file);
+    double max_y = y[0];
+    for (int i = 1; i < n; i++) {
+        if (y[i] > max_y) max_y = y[i];
+    }
+    if (!(max_y > 0)) {
+        free(sample);
+        context->condition = 0;
+        return FIT_INVALID_ARGUMENT;
+    }
     
-    // Baca data
-    while (fgets(line, sizeof(line), file) && rows < MAX_ROWS) {
-        char* token = strtok(line, ",");
-        if (token != NULL) {
-            data[rows].year = atoi(token);
-            years[rows] = data[rows].year;
+    // Titik awal: untuk K tertentu kurva dapat dilinearkan menjadi model eksponensial
+    // z = e^(r·x0)·e^(-r·x) dengan z = K/y - 1 (logistik) atau z = -ln(y/K) (Gompertz),
+    // sehingga exponentialRegression pada z memberi r = -b dan x0 = ln(a)/r. Beberapa kandidat
+    // K dicoba dan yang SSE-nya terkecil dipakai. Buffer z diambil ulang dari arena untuk setiap
+    // kandidat karena exponentialRegression melepas arena di akhir. Kandidat dibatasi max_level.
+    const double saturation[3] = {1.1, 1.5, 2.5};
+    double start_sse = HUGE_VAL;
+    for (int c = 0; c < 3; c++) {
+        double K = saturation[c] * max_y;
+        if (K > max_level) {
+            K = max_level;
         }
-        
-        token = strtok(NULL, ",");
-        if (token != NULL) {
-            data[rows].percentage = atof(token);
+        double* z = (double*)arenaAlloc(&context->arena, (size_t)n * sizeof(double));
+        if (z == NULL) {
+            resetArena(&context->arena);
+            free(sample);
+            context->condition = 0;
+            return FIT_OUT_OF_MEMORY;
         }
-        
-        token = strtok(NULL, ",");
-        if (token != NULL) {
-            data[rows].population = atof(token);
+        for (int i = 0; i < n; i++) {
+            double level = y[i] / K; // Di (0, 1) untuk y > 0; titik lain diabaikan (z = 0)
+            if (!(level > 0)) {
+                z[i] = 0;
+            } else {
+                z[i] = (curve == GROWTH_LOGISTIC) ? 1 / level - 1 : -log(level);
+            }
+        }
+        double a, b;
+        if (exponentialRegression(context, x, z, n, &a, &b) >= FIT_SINGULAR || !(fabs(b) > 0) || !(a > 0)) {
+            continue;
+        }
+        double candidate[3] = {K, -b, log(a) / -b};
+        double candidate_sse = growthResidualSquares(curve, candidate, x, y, n);
+        if (candidate_sse < start_sse) {
+            start_sse = candidate_sse;
+            params[0] = candidate[0];
+            params[1] = candidate[1];
+            params[2] = candidate[2];
         }
-        
-        rows++;
     }
-    
-    fclose(file);
-    return rows;
-}
-
-// Fungsi untuk menulis data ke file CSV
-void writeCSV(const char* filename, DataRow data[], int rows) {
-    FILE* file = fopen(filename, "w");
-    if (file == NULL) {
-        printf("Error: Tidak dapat membuka file %s untuk ditulis\n", filename);
-        return;
+    // exponentialRegression tidak melepas arena jika keluar lebih awal; buffer z tidak dipakai lagi
+    resetArena(&context->arena);
+    if (!(start_sse < HUGE_VAL)) {
+        free(sample);
+        context->condition = 0;
+        return FIT_SINGULAR;
     }
     
-    // Tulis header
-    fprintf(file, "Year,Percentage_Internet_User,Population\n");
+    double storage[9];
+    Matrix A = {storage, 3, 3, 3};
+    double normal[9], gradient[3], rhs[3], step[3], trial[3], jacobian[3];
+    double damping = 1e-3;
+    double sse = HUGE_VAL;
+    double condition = 0;
+    int converged = 0;
     
-    // Tulis data
-    for (int i = 0; i < rows; i++) {
-        fprintf(file, "%d,%.6f,%.0f\n", data[i].year, data[i].percentage, data[i].population);
+    for (int iteration = 0; iteration < GROWTH_MAX_ITERATIONS && !converged; iteration++) {
+        // Satu lintasan: JᵀJ, Jᵀe dan SSE pada parameter saat ini
+        for (int k = 0; k < 9; k++) normal[k] = 0;
+        for (int k = 0; k < 3; k++) gradient[k] = 0;
+        double current = 0;
+        for (int i = 0; i < n; i++) {
+            double residual = y[i] - evaluateGrowth(curve, params, x[i], jacobian);
+            current += residual * residual;
+            for (int p = 0; p < 3; p++) {
+                gradient[p] += jacobian[p] * residual;
+                for (int q = 0; q <= p; q++) {
+                    normal[p * 3 + q] += jacobian[p] * jacobian[q];
+                }
+            }
+        }
+        sse = current;
+        
+        // K di batas dan gradien mendorongnya naik: K dibekukan, langkah hanya pada {r, x0}
+        int level_fixed = (params[0] >= max_level && gradient[0] > 0);
+        
+        // Coba langkah dengan redaman yang makin besar sampai SSE turun
+        int accepted = 0;
+        while (!accepted && damping <= GROWTH_MAX_DAMPING) {
+            for (int p = 0; p < 3; p++) {
+                for (int q = 0; q <= p; q++) {
+                    MATRIX_AT(A, p, q) = normal[p * 3 + q];
+                }
+                MATRIX_AT(A, p, p) *= 1 + damping;
+                rhs[p] = gradient[p];
+            }
+            if (level_fixed) {
+                MATRIX_AT(A, 0, 0) = 1;
+                MATRIX_AT(A, 1, 0) = 0;
+                MATRIX_AT(A, 2, 0) = 0;
+                rhs[0] = 0;
+            }
+            if (choleskySolve(&A, rhs, step, 3, &condition)) {
+                for (int p = 0; p < 3; p++) {
+                    trial[p] = params[p] + step[p];
+                }
+                if (trial[0] > max_level) {
+                    trial[0] = max_level; // Proyeksi kembali ke batas K
+                }
+                double trial_sse = growthResidualSquares(curve, trial, x, y, n);
+                if (trial_sse < sse) {
+                    converged = (sse - trial_sse) <= GROWTH_TOLERANCE * sse;
+                    for (int p = 0; p < 3; p++) {
+                        params[p] = trial[p];
+                    }
+                    sse = trial_sse;
+                    damping = (damping > 1e-12) ? damping / 10 : damping;
+                    accepted = 1;
+                    break;
+                }
+            }
+            damping *= 10;
+        }
+        if (!accepted) {
+            // Tidak ada langkah yang menurunkan SSE: parameter sudah di minimum (lokal)
+            converged = 1;
+        }
     }
     
-    fclose(file);
+    // Estimasi kondisi JᵀJ tanpa redaman (dari iterasi terakhir)
+    for (int p = 0; p < 3; p++) {
+        for (int q = 0; q <= p; q++) {
+            MATRIX_AT(A, p, q) = normal[p * 3 + q];
+        }
+    }
+    context->condition = choleskySolve(&A, gradient, step, 3, &condition) ? condition : HUGE_VAL;
+    free(sample);
+    if (!converged || !isfinite(sse)) {
+        return FIT_NOT_CONVERGED;
+    }
+    return (context->condition > ILL_CONDITIONED_LIMIT) ? FIT_ILL_CONDITIONED : FIT_OK;
 }
 
-// Fungsi untuk membandingkan dua DataRow berdasarkan tahun
-int compareDataRows(const void* a, const void* b) {
-    DataRow* dataA = (DataRow*)a;
-    DataRow* dataB = (DataRow*)b;
-    return dataA->year - dataB->year;
+// Fungsi fit bersama keluarga kurva pertumbuhan; kualitas dinilai pada skala y asli
+FitStatus fitGrowthModel(GrowthCurve curve, const ModelFamily* family, FitContext* context, const double x[],
+                         const double y[], int n, FittedModel* model) {
+    model->parameters = 3;
+    FitStatus status = growthRegression(curve, context, x, y, n, family->level_limit, model->params);
+    if (status <= FIT_ILL_CONDITIONED) {
+        scoreModel(model, x, y, n, &model->quality);
+    }
+    return status;
 }
 
-// Fungsi untuk membandingkan dua angka (digunakan untuk qsort)
-int compare(const void* a, const void* b) {
-    return (*(int*)a - *(int*)b);
+// Keluarga logistik: params = {K, r, x0}
+FitStatus fitLogisticFamily(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                            FittedModel* model) {
+    return fitGrowthModel(GROWTH_LOGISTIC, family, context, x, y, n, model);
 }
 
-// Fungsi untuk memeriksa apakah tahun tertentu ada dalam data
-int yearExists(int year, int years[], int count) {
-    for (int i = 0; i < count; i++) {
-        if (years[i] == year) {
-            return 1;
-        }
+// Prediksi keluarga logistik
+void predictLogisticFamily(const FittedModel* model, const double x[], int n, double out[]) {
+    for (int i = 0; i < n; i++) {
+        out[i] = evaluateGrowth(GROWTH_LOGISTIC, model->params, x[i], NULL);
     }
-    return 0;
 }
 
-// Alokasi matriks
-double** allocateMatrix(int rows, int cols) {
-    double** matrix = (double**)malloc(rows * sizeof(double*));
-    for (int i = 0; i < rows; i++) {
-        matrix[i] = (double*)malloc(cols * sizeof(double));
-    }
-    return matrix;
+// Keluarga Gompertz: params = {K, r, x0}
+FitStatus fitGompertzFamily(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                            FittedModel* model) {
+    return fitGrowthModel(GROWTH_GOMPERTZ, family, context, x, y, n, model);
 }
 
-// Dealokasi matriks
-void freeMatrix(double** matrix, int rows) {
-    for (int i = 0; i < rows; i++) {
-        free(matrix[i]);
+// Prediksi keluarga Gompertz
+void predictGompertzFamily(const FittedModel* model, const double x[], int n, double out[]) {
+    for (int i = 0; i < n; i++) {
+        out[i] = evaluateGrowth(GROWTH_GOMPERTZ, model->params, x[i], NULL);
     }
-    free(matrix);
 }
 
-// Eliminasi Gauss-Jordan untuk penyelesaian sistem persamaan linier
-void gaussJordan(double** A, double* B, double* X, int n) {
-    // Matriks augmented [A|B]
-    double** augmented = allocateMatrix(n, n + 1);
-    
-    // Inisialisasi matriks augmented
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            augmented[i][j] = A[i][j];
-        }
-        augmented[i][n] = B[i];
+const ModelFamily logisticFamily = {"logistik", 0, fitLogisticFamily, predictLogisticFamily, serializeModelParameters, 0};
+const ModelFamily gompertzFamily = {"gompertz", 0, fitGompertzFamily, predictGompertzFamily, serializeModelParameters, 0};
+
+// Fungsi untuk membuat salinan keluarga pertumbuhan dengan batas atas nilai jenuh K
+ModelFamily boundedGrowthFamily(const ModelFamily* base, double level_limit) {
+    ModelFamily family = *base;
+    family.level_limit = level_limit;
+    return family;
+}
+
+#define TOURNAMENT_CHUNK 8 // Jumlah deret per potongan kerja turnamen paralel
+#define TOURNAMENT_CANDIDATES 7 // Jumlah keluarga kandidat per deret pada turnamen di main
+
+// Fungsi untuk menghitung galat validasi silang k-fold (blok berurutan) keluarga model apa pun
+// dengan fit ulang pada data latih setiap fold. training harus memuat 2*n double.
+FitStatus kFoldModelCV(const ModelFamily* family, FitContext* context, const double x[], const double y[], int n,
+                       int folds, double training[], double* rmse) {
+    if (folds < 2 || folds > n) {
+        return FIT_INVALID_ARGUMENT;
     }
-    
-    // Proses eliminasi
-    for (int i = 0; i < n; i++) {
-        // Cari pivot maksimum di kolom saat ini
-        int max_row = i;
-        for (int j = i + 1; j < n; j++) {
-            if (fabs(augmented[j][i]) > fabs(augmented[max_row][i])) {
-                max_row = j;
+    double* training_x = training;
+    double* training_y = training + n;
+    double predicted[SCORE_BLOCK];
+    double sse = 0, compensation = 0;
+    FitStatus result = FIT_OK;
+    for (int f = 0; f < folds; f++) {
+        int begin = (int)((long long)n * f / folds);
+        int end = (int)((long long)n * (f + 1) / folds);
+        int m = 0;
+        for (int i = 0; i < n; i++) {
+            if (i < begin || i >= end) {
+                training_x[m] = x[i];
+                training_y[m] = y[i];
+                m++;
             }
         }
         
-        // Tukar baris jika perlu
-        if (max_row != i) {
-            for (int j = 0; j <= n; j++) {
-                double temp = augmented[i][j];
-                augmented[i][j] = augmented[max_row][j];
-                augmented[max_row][j] = temp;
+        FittedModel model;
+        FitStatus status = fitModel(family, context, training_x, training_y, m, &model);
+        if (status >= FIT_SINGULAR) {
+            return status;
+        }
+        if (status > result) {
+            result = status;
+        }
+        for (int block = begin; block < end; block += SCORE_BLOCK) {
+            int length = (end - block < SCORE_BLOCK) ? end - block : SCORE_BLOCK;
+            family->predict(&model, x + block, length, predicted);
+            for (int i = 0; i < length; i++) {
+                double residual = y[block + i] - predicted[i];
+                twoSum(&sse, &compensation, residual * residual);
             }
         }
+    }
+    *rmse = sqrt((sse + compensation) / n);
+    return result;
+}
+
+// Data tugas turnamen model paralel. Kandidat, hasil dan galat deret s untuk keluarga f ada di
+// indeks s*family_count + f pada families, models dan heldout; best[s] berisi indeks pemenang.
+typedef struct {
+    const Series* series;
+    const ModelFamily* const* families;
+    int family_count;
+    int folds;
+    FittedModel* models;
+    double* heldout;
+    int* best;
+} TournamentJob;
+
+// Task paralel: turnamen untuk deret [begin, end) dengan konteks fit milik pekerja.
+// Kandidat linear dan polinomial berbagi satu tabel momen per fold (kFoldCVRange) yang juga
+// memberikan momen seluruh data untuk fit penuhnya; keluarga lain di-fit ulang per fold.
+void tournamentTask(void* job, FitContext* context, int begin, int end) {
+    TournamentJob* tournament = (TournamentJob*)job;
+    int family_count = tournament->family_count;
+    
+    for (int s = begin; s < end; s++) {
+        const Series* series = &tournament->series[s];
+        const ModelFamily* const* families = tournament->families + (size_t)s * family_count;
+        FittedModel* models = tournament->models + (size_t)s * family_count;
+        double* heldout = tournament->heldout + (size_t)s * family_count;
         
-        // Normalisasi baris pivot
-        double pivot = augmented[i][i];
-        if (fabs(pivot) < 1e-10) {
-            printf("Error: Matriks singular, tidak dapat menyelesaikan sistem.\n");
-            exit(1);
+        // Rentang derajat kandidat polinomial (linear termasuk sebagai derajat 1)
+        int min_degree = MAX_DEGREE + 1;
+        int max_degree = -1;
+        for (int f = 0; f < family_count; f++) {
+            const ModelFamily* family = families[f];
+            if (isPolynomialFamily(family)) {
+                if (family->degree < min_degree) min_degree = family->degree;
+                if (family->degree > max_degree) max_degree = family->degree;
+            }
         }
         
-        for (int j = 0; j <= n; j++) {
-            augmented[i][j] /= pivot;
+        double range_rmse[MAX_DEGREE + 1];
+        FitStatus range_status[MAX_DEGREE + 1];
+        double total[MOMENT_COUNT(MAX_DEGREE)];
+        FitStatus shared = FIT_INVALID_ARGUMENT;
+        if (max_degree >= 0) {
+            shared = kFoldCVRange(context, series->x, series->y, series->n, min_degree, max_degree,
+                                  tournament->folds, range_rmse, range_status, total);
         }
+        double* training = NULL;
         
-        // Eliminasi baris lain
-        for (int j = 0; j < n; j++) {
-            if (j != i) {
-                double factor = augmented[j][i];
-                for (int k = 0; k <= n; k++) {
-                    augmented[j][k] -= factor * augmented[i][k];
+        tournament->best[s] = -1;
+        for (int f = 0; f < family_count; f++) {
+            const ModelFamily* family = families[f];
+            FittedModel* model = &models[f];
+            heldout[f] = NAN;
+            
+            if (isPolynomialFamily(family) && shared == FIT_OK) {
+                // Fit penuh dari momen total: awalan momen untuk derajat ini
+                int degree = family->degree;
+                Matrix A = arenaMatrix(&context->arena, degree + 1, degree + 1);
+                model->family = family;
+                model->parameters = degree + 1;
+                model->condition = 0;
+                model->status = (A.data == NULL) ? FIT_OUT_OF_MEMORY
+                    : solveNormalEquations(&context->arena, &A, total, total + 2 * max_degree + 1, degree,
+                                           model->params, &model->condition);
+                resetArena(&context->arena);
+                if (model->status <= FIT_ILL_CONDITIONED) {
+                    fitQualityFromMoments(total, total + 2 * max_degree + 1, total[MOMENT_COUNT(max_degree) - 1],
+                                          model->params, degree, &model->quality);
+                    heldout[f] = range_rmse[degree - min_degree];
                 }
+            } else {
+                if (fitModel(family, context, series->x, series->y, series->n, model) <= FIT_ILL_CONDITIONED) {
+                    if (training == NULL) {
+                        training = (double*)malloc(2 * (size_t)series->n * sizeof(double));
+                    }
+                    double rmse;
+                    if (training != NULL &&
+                        kFoldModelCV(family, context, series->x, series->y, series->n, tournament->folds,
+                                     training, &rmse) <= FIT_ILL_CONDITIONED) {
+                        heldout[f] = rmse;
+                    }
+                }
+            }
+            
+            int best = tournament->best[s];
+            if (model->status <= FIT_ILL_CONDITIONED && !isnan(heldout[f]) &&
+                (best < 0 || heldout[f] < heldout[best])) {
+                tournament->best[s] = f;
             }
         }
+        free(training);
     }
+}
+
+// Fungsi untuk menjalankan turnamen model: setiap keluarga di-fit pada setiap deret secara
+// paralel, dinilai dengan galat validasi silang k-fold (blok berurutan), dan keluarga dengan
+// galat di luar sampel terkecil dipilih per deret. families memuat family_count kandidat untuk
+// setiap deret (sehingga batas seperti level_limit dapat berbeda per deret); families, models
+// dan heldout berukuran count*family_count; best[s] berisi indeks pemenang deret s (-1 jika semua gagal).
+// Mengembalikan jumlah deret yang memiliki pemenang.
+int runModelTournament(ThreadPool* pool, const Series series[], int count, const ModelFamily* const families[],
+                       int family_count, int folds, FittedModel models[], double heldout[], int best[]) {
+    TournamentJob job = {series, families, family_count, folds, models, heldout, best};
+    runParallel(pool, tournamentTask, &job, count, TOURNAMENT_CHUNK);
     
-    // Ambil solusi
-    for (int i = 0; i < n; i++) {
-        X[i] = augmented[i][n];
+    int decided = 0;
+    for (int s = 0; s < count; s++) {
+        if (best[s] >= 0) {
+            decided++;
+        }
     }
-    
-    // Bersihkan memori
-    freeMatrix(augmented, n);
+    return decided;
 }
 
-// Fungsi untuk melakukan regresi polinomial
-void polynomialRegression(double x[], double y[], int n, double coef[], int degree) {
-    // Membuat matriks normal equations
-    double** A = allocateMatrix(degree + 1, degree + 1);
-    double* B = (double*)malloc((degree + 1) * sizeof(double));
-    
-    // Inisialisasi matriks A dan vektor B dengan 0
-    for (int i = 0; i <= degree; i++) {
-        for (int j = 0; j <= degree; j++) {
-            A[i][j] = 0;
+#ifdef SELF_CHECK
+// Pemeriksaan mandiri jalur regresi yang tidak dipakai langsung oleh alur utama, terhadap acuan
+// dua lintasan polynomialRegression/calculateRSquared pada data sintetis deterministik. Hanya
+// dikompilasi dengan -DSELF_CHECK; program hasilnya menjalankan pemeriksaan alih-alih alur utama.
+
+#define CHECK_SERIES 96 // Jumlah deret pada pemeriksaan fit batch
+#define CHECK_THREADS 4 // Jumlah thread pemeriksaan (tetap, agar pekerjaan benar-benar terbagi)
+#define CHECK_WINDOW 48 // Lebar jendela pada pemeriksaan fitter bergulir
+#define CHECK_STREAM 2000 // Jumlah titik pada pemeriksaan RLS
+
+// Fungsi untuk membandingkan hasil pemeriksaan dengan nilai acuan (galat relatif terhadap
+// max(|expected|, 1)). Mencetak hasilnya dan mengembalikan 1 jika gagal.
+int checkClose(const char* label, double actual, double expected, double tolerance) {
+    double error = fabs(actual - expected) / fmax(fabs(expected), 1);
+    int failed = !(error <= tolerance);
+    printf("%-6s %-52s galat relatif %.2e\n", failed ? "GAGAL" : "OK", label, error);
+    return failed;
+}
+
+// Fungsi untuk membangkitkan derau semu deterministik di [-0.5, 0.5) (LCG 64-bit)
+double checkNoise(uint64_t* state) {
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(*state >> 11) / 9007199254740992.0 - 0.5;
+}
+
+// Fungsi untuk membagi data pemeriksaan menjadi CHECK_SERIES deret dengan panjang berbeda-beda
+void splitCheckSeries(const double x[], const double y[], int n, Series series[]) {
+    int length = n / CHECK_SERIES;
+    for (int s = 0; s < CHECK_SERIES; s++) {
+        series[s].x = x + (size_t)s * length;
+        series[s].y = y + (size_t)s * length;
+        series[s].n = length - s % 7;
+    }
+}
+
+// Fungsi untuk memeriksa bahwa hasil fit batch sama persis (status dan koefisien) dengan
+// fit tunggal polynomialRegression setiap deret. Mencetak hasilnya dan mengembalikan 1 jika gagal.
+int checkBatchResults(const char* label, FitContext* context, const Series series[], const SeriesFit results[],
+                      int fitted, int degree) {
+    double coef[MAX_DEGREE + 1];
+    int mismatched = (fitted != CHECK_SERIES);
+    for (int s = 0; s < CHECK_SERIES && !mismatched; s++) {
+        FitStatus status = polynomialRegression(context, series[s].x, series[s].y, series[s].n, coef, degree);
+        mismatched = (status != results[s].status) ||
+                     memcmp(coef, results[s].coef, (degree + 1) * sizeof(double)) != 0;
+    }
+    printf("%-6s %-52s %d deret\n", mismatched ? "GAGAL" : "OK", label, CHECK_SERIES);
+    return mismatched;
+}
+
+// Pemeriksaan fit batch satu thread: setiap deret harus sama persis dengan fit tunggalnya
+int checkBatchFit(FitContext* context, const double x[], const double y[], int n) {
+    Series series[CHECK_SERIES];
+    SeriesFit results[CHECK_SERIES];
+    splitCheckSeries(x, y, n, series);
+    int fitted = fitPolynomialBatch(context, series, CHECK_SERIES, 2, results);
+    return checkBatchResults("fitPolynomialBatch sama dengan fit tunggal", context, series, results, fitted, 2);
+}
+
+// Pemeriksaan fit batch lewat thread pool: hasil tidak boleh bergantung pada pembagian kerja
+int checkBatchFitParallel(FitContext* context, ThreadPool* pool, const double x[], const double y[], int n) {
+    Series series[CHECK_SERIES];
+    SeriesFit results[CHECK_SERIES];
+    splitCheckSeries(x, y, n, series);
+    int fitted = fitPolynomialBatchParallel(pool, series, CHECK_SERIES, 3, results);
+    return checkBatchResults("fitPolynomialBatchParallel sama dengan fit tunggal", context, series, results, fitted, 3);
+}
+
+// Pemeriksaan reduksi momen dan R² paralel pada satu deret panjang terhadap versi berurutan
+int checkParallelReduction(FitContext* context, ThreadPool* pool, const double x[], const double y[], int n) {
+    double reference[4], coef[4];
+    char label[64];
+    if (polynomialRegression(context, x, y, n, reference, 3) > FIT_ILL_CONDITIONED ||
+        polynomialRegressionParallel(context, pool, x, y, n, coef, 3) > FIT_ILL_CONDITIONED) {
+        printf("GAGAL  polynomialRegressionParallel\n");
+        return 1;
+    }
+    int failures = 0;
+    for (int k = 0; k <= 3; k++) {
+        snprintf(label, sizeof(label), "polynomialRegressionParallel koefisien x^%d", k);
+        failures += checkClose(label, coef[k], reference[k], 1e-9);
+    }
+    failures += checkClose("calculateRSquaredParallel", calculateRSquaredParallel(context, pool, x, y, n, reference, 3),
+                           calculateRSquared(x, y, n, reference, 3), 1e-10);
+    return failures;
+}
+
+// Pemeriksaan QR Householder dalam basis ternormalisasi: prediksinya dibandingkan dengan fit
+// persamaan normal pada data berkondisi baik (kedua metode harus memberi model yang sama)
+int checkPolynomialQR(FitContext* context, const double x[], const double y[], int n) {
+    double reference[4];
+    PolynomialModel model;
+    if (polynomialRegression(context, x, y, n, reference, 3) > FIT_ILL_CONDITIONED ||
+        polynomialRegressionQR(context, x, y, n, 3, &model) > FIT_ILL_CONDITIONED) {
+        printf("GAGAL  polynomialRegressionQR\n");
+        return 1;
+    }
+    double worst = 0;
+    for (int i = 0; i < n; i += n / 16) {
+        double expected = evaluatePolynomial(x[i], reference, 3);
+        double error = fabs(evaluateModel(&model, x[i]) - expected) / fmax(fabs(expected), 1);
+        if (error > worst) worst = error;
+    }
+    return checkClose("polynomialRegressionQR prediksi", worst, 0, 1e-9);
+}
+
+// Pemeriksaan jendela bergulir: setelah setiap pembaruan, model dibandingkan dengan fit ulang
+// brute-force pada CHECK_WINDOW titik terakhir. x berupa tahun mentah (jauh dari nol) agar
+// pemusatan ulang basis ikut teruji; acuan di-fit pada x yang dipusatkan ke titik terbaru.
+int checkRollingFit(FitContext* context, const double y[], int n) {
+    RollingFit rolling;
+    if (!initRollingFit(&rolling, CHECK_WINDOW, 2)) {
+        printf("GAGAL  initRollingFit\n");
+        return 1;
+    }
+    int updates = 10 * CHECK_WINDOW;
+    int stride = n / updates;
+    double window_x[CHECK_WINDOW], window_y[CHECK_WINDOW], coef[3];
+    double worst = 0;
+    for (int i = 0; i < updates; i++) {
+        double year = 1960 + 0.25 * i;
+        FitStatus status = updateRollingFit(&rolling, year, y[i * stride]);
+        if (i + 1 < CHECK_WINDOW || status > FIT_ILL_CONDITIONED) {
+            continue;
+        }
+        int first = i + 1 - CHECK_WINDOW;
+        for (int j = 0; j < CHECK_WINDOW; j++) {
+            window_x[j] = 0.25 * (first + j - i);
+            window_y[j] = y[(first + j) * stride];
         }
-        B[i] = 0;
+        if (polynomialRegression(context, window_x, window_y, CHECK_WINDOW, coef, 2) > FIT_ILL_CONDITIONED) {
+            continue;
+        }
+        for (int j = 0; j < CHECK_WINDOW; j += CHECK_WINDOW / 4) {
+            double expected = evaluatePolynomial(window_x[j], coef, 2);
+            double error = fabs(evaluateModel(&rolling.model, window_x[j] + year) - expected) / fmax(fabs(expected), 1);
+            if (error > worst) worst = error;
+        }
+    }
+    freeRollingFit(&rolling);
+    return checkClose("updateRollingFit terhadap fit ulang jendela", worst, 0, 1e-8);
+}
+
+// Pemeriksaan RLS tanpa faktor lupa: hasilnya harus mendekati regresi biasa pada titik yang
+// sama, baik linear maupun eksponensial (ln y). Prior P = δI membuat selisih kecil tetapi tidak nol.
+int checkRecursiveFit(FitContext* context, const double x[], const double y[], int n) {
+    double sample_x[CHECK_STREAM], sample_y[CHECK_STREAM], positive[CHECK_STREAM];
+    uint64_t state = 777;
+    int stride = n / CHECK_STREAM;
+    for (int i = 0; i < CHECK_STREAM; i++) {
+        sample_x[i] = x[i * stride];
+        sample_y[i] = y[i * stride];
+        positive[i] = 2 * exp(0.02 * sample_x[i]) * (1 + 0.01 * checkNoise(&state));
     }
     
-    // Hitung komponen matriks A
-    for (int i = 0; i <= degree; i++) {
-        for (int j = 0; j <= degree; j++) {
-            for (int k = 0; k < n; k++) {
-                A[i][j] += pow(x[k], i + j);
-            }
+    int failures = 0;
+    RecursiveFit recursive;
+    double line[2];
+    if (initRecursiveFit(&recursive, 1, 1, 0, 40, 0) == FIT_OK &&
+        polynomialRegression(context, sample_x, sample_y, CHECK_STREAM, line, 1) <= FIT_ILL_CONDITIONED) {
+        for (int i = 0; i < CHECK_STREAM; i++) {
+            updateRecursiveFit(&recursive, sample_x[i], sample_y[i]);
         }
+        failures += checkClose("updateRecursiveFit linear tanpa faktor lupa", predictRecursiveFit(&recursive, 25),
+                               evaluatePolynomial(25, line, 1), 1e-6);
+    } else {
+        printf("GAGAL  updateRecursiveFit linear\n");
+        failures++;
     }
     
-    // Hitung komponen vektor B
-    for (int i = 0; i <= degree; i++) {
-        for (int k = 0; k < n; k++) {
-            B[i] += y[k] * pow(x[k], i);
+    double a, b;
+    if (initRecursiveFit(&recursive, 1, 1, 0, 40, 1) == FIT_OK &&
+        exponentialRegression(context, sample_x, positive, CHECK_STREAM, &a, &b) <= FIT_ILL_CONDITIONED) {
+        for (int i = 0; i < CHECK_STREAM; i++) {
+            updateRecursiveFit(&recursive, sample_x[i], positive[i]);
         }
+        failures += checkClose("updateRecursiveFit eksponensial tanpa faktor lupa", predictRecursiveFit(&recursive, 25),
+                               a * exp(b * 25), 1e-6);
+    } else {
+        printf("GAGAL  updateRecursiveFit eksponensial\n");
+        failures++;
+    }
+    return failures;
+}
+
+// Fungsi untuk menjalankan semua pemeriksaan pada satu deret panjang (beberapa potongan reduksi)
+// berbentuk kubik dengan derau. Mengembalikan jumlah pemeriksaan yang gagal (0 berarti semua lolos).
+int runSelfCheck(void) {
+    int n = 3 * REDUCTION_CHUNK + 1234;
+    double* x = (double*)malloc(2 * (size_t)n * sizeof(double));
+    if (x == NULL) {
+        printf("Error: Memori tidak cukup untuk pemeriksaan\n");
+        return 1;
+    }
+    double* y = x + n;
+    uint64_t state = 12345;
+    for (int i = 0; i < n; i++) {
+        x[i] = -40 + 80.0 * i / n;
+        y[i] = 5 + 0.8 * x[i] - 0.03 * x[i] * x[i] + 0.0004 * x[i] * x[i] * x[i] + checkNoise(&state);
+    }
+    
+    FitContext context;
+    initFitContext(&context);
+    ThreadPool pool;
+    if (initThreadPool(&pool, CHECK_THREADS) == 0) {
+        printf("Error: Thread pool tidak dapat dibuat\n");
+        freeFitContext(&context);
+        free(x);
+        return 1;
     }
     
-    // Selesaikan sistem persamaan linier untuk mendapatkan koefisien
-    gaussJordan(A, B, coef, degree + 1);
+    printf("Pemeriksaan mandiri (%d thread):\n", pool.threads);
+    int failures = 0;
+    failures += checkBatchFit(&context, x, y, n);
+    failures += checkBatchFitParallel(&context, &pool, x, y, n);
+    failures += checkParallelReduction(&context, &pool, x, y, n);
+    failures += checkPolynomialQR(&context, x, y, n);
+    failures += checkRollingFit(&context, y, n);
+    failures += checkRecursiveFit(&context, x, y, n);
     
-    // Bersihkan memori
-    freeMatrix(A, degree + 1);
-    free(B);
+    freeThreadPool(&pool);
+    freeFitContext(&context);
+    free(x);
+    printf("%s: %d pemeriksaan gagal\n", failures ? "GAGAL" : "LOLOS", failures);
+    return failures;
 }
+#endif
 
-// Fungsi untuk mengevaluasi polinomial pada nilai x tertentu
-double evaluatePolynomial(double x, double coef[], int degree) {
-    double result = 0;
-    for (int i = 0; i <= degree; i++) {
-        result += coef[i] * pow(x, i);
+// Prediksi setiap model untuk tahun-tahun yang hilang. Semua irisan berukuran n_missing dan
+// berbagi satu blok memori yang dimiliki oleh x.
+typedef struct {
+    double* x;                      // Tahun ternormalisasi
+    double* polynomial_percentage;  // Model polinomial utama, dipotong ke [0, 100]
+    double* polynomial_population;
+    double* tournament_percentage;  // Pemenang turnamen (polinomial jika tidak ada pemenang)
+    double* tournament_population;
+    double* exponential_percentage; // Model eksponensial (persentase) dan linear (populasi)
+    double* linear_population;
+} MissingPredictions;
+
+// Fungsi untuk mengalokasikan semua irisan prediksi tahun yang hilang dalam satu blok
+int initMissingPredictions(MissingPredictions* predictions, int n_missing) {
+    double** slices[] = {
+        &predictions->x, &predictions->polynomial_percentage, &predictions->polynomial_population,
+        &predictions->tournament_percentage, &predictions->tournament_population,
+        &predictions->exponential_percentage, &predictions->linear_population
+    };
+    int count = (int)(sizeof(slices) / sizeof(slices[0]));
+    double* block = (double*)malloc((size_t)count * (n_missing > 0 ? n_missing : 1) * sizeof(double));
+    for (int k = 0; k < count; k++) {
+        *slices[k] = (block != NULL) ? block + (size_t)k * n_missing : NULL;
     }
-    return result;
+    return block != NULL;
 }
 
-// Fungsi untuk normalisasi tahun (mengurangi dengan tahun dasar)
-void normalizeYears(int original_years[], double normalized_years[], int n, int base_year) {
-    for (int i = 0; i < n; i++) {
-        normalized_years[i] = (double)(original_years[i] - base_year);
+// Fungsi untuk mengganti nilai baris imputasi dataset dengan prediksi model lain.
+// Dataset dan missing_years harus terurut naik berdasarkan tahun.
+void replaceImputedValues(Dataset* dataset, const int missing_years[], int n_missing,
+                          const double percentages[], const double populations[]) {
+    for (int i = 0, m = 0; i < dataset->rows && m < n_missing; i++) {
+        if (dataset->year[i] == missing_years[m]) {
+            dataset->percentage[i] = percentages[m];
+            dataset->population[i] = populations[m];
+            m++;
+        }
     }
 }
 
-// Fungsi untuk menghitung koefisien korelasi (R²)
-double calculateRSquared(double x[], double y[], int n, double coef[], int degree) {
-    double mean_y = 0;
-    for (int i = 0; i < n; i++) {
-        mean_y += y[i];
+// Fungsi untuk menulis nama keluarga model yang mudah dibaca (dengan derajat untuk polinomial)
+void formatModelName(const ModelFamily* family, char* buffer, size_t size) {
+    if (family->degree > 1) {
+        snprintf(buffer, size, "%s derajat %d", family->name, family->degree);
+    } else {
+        snprintf(buffer, size, "%s", family->name);
     }
-    mean_y /= n;
-    
-    double ss_total = 0;
-    double ss_residual = 0;
-    
-    for (int i = 0; i < n; i++) {
-        double y_pred = evaluatePolynomial(x[i], coef, degree);
-        ss_total += pow(y[i] - mean_y, 2);
-        ss_residual += pow(y[i] - y_pred, 2);
+}
+
+// Fungsi untuk mencetak perbandingan beberapa model hasil fitModels untuk satu deret.
+// Penanda hanya menunjukkan R² terkoreksi tertinggi dalam sampel, bukan pemenang turnamen.
+void printModelComparison(const char* label, const FittedModel models[], int count, int best) {
+    printf("- %s:\n", label);
+    for (int f = 0; f < count; f++) {
+        const FittedModel* model = &models[f];
+        if (model->status >= FIT_SINGULAR) {
+            printf("    %-22s gagal (%s)\n", model->family->name, fitStatusMessage(model->status));
+            continue;
+        }
+        char name[32];
+        formatModelName(model->family, name, sizeof(name));
+        printf("    %-22s R² %.4f, R² terkoreksi %.4f, RMSE %.4g%s\n", name, model->quality.r_squared,
+            model->quality.adjusted_r_squared, model->quality.rmse, (f == best) ? "  <- R² terkoreksi tertinggi" : "");
     }
-    
-    return 1 - (ss_residual / ss_total);
 }
 
-int main() {
-    DataRow data[MAX_ROWS];
-    int years[MAX_YEARS];
-    int rows = readCSV("Data Tugas Pemrograman A.csv", data, years);
+int main(int argc, char* argv[]) {
+    // File masukan dapat diberikan sebagai argumen (CSV atau dataset biner).
+    // Argumen kedua (opsional) adalah derajat maksimum untuk pemilihan derajat otomatis (BIC).
+#ifdef SELF_CHECK
+    // Program pemeriksaan: jalankan pemeriksaan mandiri alih-alih alur utama
+    (void)argc;
+    (void)argv;
+    return runSelfCheck() ? 1 : 0;
+#endif
+    const char* input_file = (argc > 1) ? argv[1] : "Data Tugas Pemrograman A.csv";
+    int max_auto_degree = (argc > 2) ? atoi(argv[2]) : 0;
+    
+    Dataset dataset;
+    int rows = readDataset(input_file, &dataset);
     
     if (rows == 0) {
         printf("Error: Tidak ada data yang dibaca!\n");
+        freeDataset(&dataset);
         return 1;
     }
     
     printf("Data yang berhasil dibaca: %d baris\n", rows);
     
-    // Cari tahun yang hilang
-    int missing_years[MISSING_YEARS] = {2005, 2006, 2015, 2016};
-    
     // Urutkan data berdasarkan tahun
-    qsort(data, rows, sizeof(DataRow), compareDataRows);
+    sortDatasetByYear(&dataset);
+    
+    // Normalisasi kolom tahun sekali untuk membuat perhitungan lebih stabil
+    int base_year = 2000; // Tahun dasar untuk normalisasi
+    double* normalized_years = (double*)malloc(rows * sizeof(double));
+    normalizeYears(dataset.year, normalized_years, rows, base_year);
     
     // Menyiapkan array untuk regresi persentase pengguna internet
-    int original_years_internet[MAX_ROWS];
-    double normalized_years_internet[MAX_ROWS];
-    double percentages[MAX_ROWS];
+    double* normalized_years_internet = (double*)malloc(rows * sizeof(double));
+    double* percentages = (double*)malloc(rows * sizeof(double));
     int n_internet = 0;
-    int base_year = 2000; // Tahun dasar untuk normalisasi
     
-    // Menyiapkan array untuk regresi populasi
-    int original_years_population[MAX_ROWS];
-    double normalized_years_population[MAX_ROWS];
-    double populations[MAX_ROWS];
-    int n_population = 0;
+    // Regresi populasi membaca kolom dataset secara langsung; salinan terpisah
+    // hanya dibuat jika ada baris dengan populasi kosong
+    const double* normalized_years_population = normalized_years;
+    const double* populations = dataset.population;
+    double* population_x_buffer = NULL;
+    double* population_y_buffer = NULL;
+    int n_population = rows;
+    int missing_population = 0;
     
     // Filter data setelah tahun 2000 untuk persentase internet
     // Ini mengikuti pola pemfilteran pada kode original
     for (int i = 0; i < rows; i++) {
-        if (data[i].year >= 2000 && data[i].percentage > 0) {
-            original_years_internet[n_internet] = data[i].year;
-            percentages[n_internet] = data[i].percentage;
+        if ((dataset.valid[i] & VALID_PERCENTAGE) && dataset.year[i] >= 2000 && dataset.percentage[i] > 0) {
+            normalized_years_internet[n_internet] = normalized_years[i];
+            percentages[n_internet] = dataset.percentage[i];
             n_internet++;
         }
-        
-        // Gunakan semua data untuk populasi
-        original_years_population[n_population] = data[i].year;
-        populations[n_population] = data[i].population;
-        n_population++;
+        if (!(dataset.valid[i] & VALID_POPULATION)) {
+            missing_population++;
+        }
     }
     
-    // Normalisasi tahun untuk membuat perhitungan lebih stabil
-    normalizeYears(original_years_internet, normalized_years_internet, n_internet, base_year);
-    normalizeYears(original_years_population, normalized_years_population, n_population, base_year);
+    if (missing_population > 0) {
+        population_x_buffer = (double*)malloc(rows * sizeof(double));
+        population_y_buffer = (double*)malloc(rows * sizeof(double));
+        n_population = 0;
+        for (int i = 0; i < rows; i++) {
+            if (dataset.valid[i] & VALID_POPULATION) {
+                population_x_buffer[n_population] = normalized_years[i];
+                population_y_buffer[n_population] = dataset.population[i];
+                n_population++;
+            }
+        }
+        normalized_years_population = population_x_buffer;
+        populations = population_y_buffer;
+    }
     
     // Derajat polinomial
     int degree_internet = 3; // Derajat polinomial untuk persentase internet
     int degree_population = 2; // Derajat polinomial untuk populasi
     
+    // Konteks fit bersama untuk kedua regresi
+    FitContext fit_context;
+    initFitContext(&fit_context);
+    
+    // Pemilihan derajat otomatis jika diminta; derajat bawaan dipakai jika pencarian gagal
+    // atau hasilnya tidak berkondisi baik
+    if (max_auto_degree > 0) {
+        double selection_coef[MAX_DEGREE + 1];
+        int selected;
+        if (max_auto_degree > MAX_DEGREE) {
+            max_auto_degree = MAX_DEGREE;
+        }
+        if (selectPolynomialDegree(&fit_context, normalized_years_internet, percentages, n_internet, max_auto_degree,
+                                   CRITERION_BIC, selection_coef, &selected, NULL) == FIT_OK) {
+            degree_internet = selected;
+        }
+        if (selectPolynomialDegree(&fit_context, normalized_years_population, populations, n_population, max_auto_degree,
+                                   CRITERION_BIC, selection_coef, &selected, NULL) == FIT_OK) {
+            degree_population = selected;
+        }
+        printf("Derajat terpilih (BIC, maksimum %d): persentase internet %d, populasi %d\n",
+            max_auto_degree, degree_internet, degree_population);
+    }
+    
     // Array untuk koefisien polinomial
     double* coef_internet = (double*)malloc((degree_internet + 1) * sizeof(double));
     double* coef_population = (double*)malloc((degree_population + 1) * sizeof(double));
     
-    // Melakukan regresi polinomial untuk persentase pengguna internet
-    polynomialRegression(normalized_years_internet, percentages, n_internet, coef_internet, degree_internet);
+    // Melakukan regresi polinomial untuk persentase pengguna internet (R² dihitung dalam lintasan yang sama)
+    FitQuality quality_internet;
+    FitStatus status_internet = polynomialRegressionWithQuality(&fit_context, normalized_years_internet, percentages, n_internet,
+                                                                coef_internet, degree_internet, &quality_internet);
+    double condition_internet = fit_context.condition;
+    
+    // Melakukan regresi polinomial untuk populasi
+    FitQuality quality_population;
+    FitStatus status_population = polynomialRegressionWithQuality(&fit_context, normalized_years_population, populations, n_population,
+                                                                  coef_population, degree_population, &quality_population);
+    double condition_population = fit_context.condition;
+    
+    if (status_internet >= FIT_SINGULAR || status_population >= FIT_SINGULAR) {
+        printf("Error: Regresi gagal (persentase internet: %s, populasi: %s)\n",
+            fitStatusMessage(status_internet), fitStatusMessage(status_population));
+        freeDataset(&dataset);
+        free(normalized_years);
+        free(normalized_years_internet);
+        free(percentages);
+        free(population_x_buffer);
+        free(population_y_buffer);
+        free(coef_internet);
+        free(coef_population);
+        freeFitContext(&fit_context);
+        return 1;
+    }
     
-    // Hitung R² untuk model persentase internet
-    double r_squared_internet = calculateRSquared(normalized_years_internet, percentages, n_internet, coef_internet, degree_internet);
+    double r_squared_internet = quality_internet.r_squared;
     
     printf("\nHasil Regresi Polinomial (Persentase Internet):\n");
     printf("Model: y = ");
@@ -336,12 +4161,11 @@ int main() {
     }
     printf("\n");
     printf("R² (koefisien determinasi): %.4f\n", r_squared_internet);
+    if (status_internet == FIT_ILL_CONDITIONED) {
+        printf("Peringatan: %s (estimasi bilangan kondisi %.2e)\n", fitStatusMessage(status_internet), condition_internet);
+    }
     
-    // Melakukan regresi polinomial untuk populasi
-    polynomialRegression(normalized_years_population, populations, n_population, coef_population, degree_population);
-    
-    // Hitung R² untuk model populasi
-    double r_squared_population = calculateRSquared(normalized_years_population, populations, n_population, coef_population, degree_population);
+    double r_squared_population = quality_population.r_squared;
     
     printf("\nHasil Regresi Polinomial (Populasi):\n");
     printf("Model: y = ");
@@ -355,73 +4179,239 @@ int main() {
     }
     printf("\n");
     printf("R² (koefisien determinasi): %.4f\n", r_squared_population);
+    if (status_population == FIT_ILL_CONDITIONED) {
+        printf("Peringatan: %s (estimasi bilangan kondisi %.2e)\n", fitStatusMessage(status_population), condition_population);
+    }
+    
+    // Galat di luar sampel: LOOCV eksak dari leverage dan 5-fold dengan blok tahun berurutan.
+    // Dihitung sebelum baris imputasi ditambahkan karena kolom dataset dapat dialokasikan ulang.
+    double loo_internet, kfold_internet, loo_population, kfold_population;
+    int cv_internet_ok =
+        leaveOneOutCV(&fit_context, normalized_years_internet, percentages, n_internet, degree_internet, &loo_internet, NULL) <= FIT_ILL_CONDITIONED &&
+        kFoldCV(&fit_context, normalized_years_internet, percentages, n_internet, degree_internet, 5, &kfold_internet) <= FIT_ILL_CONDITIONED;
+    int cv_population_ok =
+        leaveOneOutCV(&fit_context, normalized_years_population, populations, n_population, degree_population, &loo_population, NULL) <= FIT_ILL_CONDITIONED &&
+        kFoldCV(&fit_context, normalized_years_population, populations, n_population, degree_population, 5, &kfold_population) <= FIT_ILL_CONDITIONED;
+    
+    // Bandingkan keluarga model linear, eksponensial, polinomial, logistik dan Gompertz pada data yang sama.
+    // Nilai jenuh K kurva pertumbuhan untuk persentase dibatasi 100%.
+    ModelFamily internet_polynomial = polynomialFamily(degree_internet);
+    ModelFamily population_polynomial = polynomialFamily(degree_population);
+    ModelFamily internet_logistic = boundedGrowthFamily(&logisticFamily, 100);
+    ModelFamily internet_gompertz = boundedGrowthFamily(&gompertzFamily, 100);
+    const ModelFamily* internet_families[5] = {&linearFamily, &exponentialFamily, &internet_polynomial,
+                                               &internet_logistic, &internet_gompertz};
+    const ModelFamily* population_families[5] = {&linearFamily, &exponentialFamily, &population_polynomial,
+                                                 &logisticFamily, &gompertzFamily};
+    FittedModel internet_models[5];
+    FittedModel population_models[5];
+    int best_internet = fitModels(internet_families, 5, &fit_context, normalized_years_internet, percentages,
+                                  n_internet, internet_models);
+    int best_population = fitModels(population_families, 5, &fit_context, normalized_years_population, populations,
+                                    n_population, population_models);
+    
+    // Turnamen model: setiap keluarga kandidat di-fit pada kedua deret secara paralel dan
+    // dinilai dengan galat validasi silang 5-fold; pemenang dipakai untuk file imputasi terpisah
+    ModelFamily quadratic_family = polynomialFamily(2);
+    ModelFamily cubic_family = polynomialFamily(3);
+    ModelFamily quartic_family = polynomialFamily(4);
+    const ModelFamily* candidates[2 * TOURNAMENT_CANDIDATES] = {
+        &linearFamily, &exponentialFamily, &quadratic_family, &cubic_family, &quartic_family,
+        &internet_logistic, &internet_gompertz,
+        &linearFamily, &exponentialFamily, &quadratic_family, &cubic_family, &quartic_family,
+        &logisticFamily, &gompertzFamily
+    };
+    Series tournament_series[2] = {
+        {normalized_years_internet, percentages, n_internet},
+        {normalized_years_population, populations, n_population}
+    };
+    FittedModel tournament_models[2 * TOURNAMENT_CANDIDATES];
+    double tournament_heldout[2 * TOURNAMENT_CANDIDATES];
+    int tournament_best[2] = {-1, -1};
+    // Satu tugas per deret, sehingga pekerja di atas jumlah deret hanya akan menganggur
+    int tournament_threads = availableCores();
+    if (tournament_threads > 2) {
+        tournament_threads = 2;
+    }
+    ThreadPool pool;
+    if (initThreadPool(&pool, tournament_threads) > 0) {
+        runModelTournament(&pool, tournament_series, 2, candidates, TOURNAMENT_CANDIDATES, 5, tournament_models,
+                           tournament_heldout, tournament_best);
+        freeThreadPool(&pool);
+    }
     
     // Memprediksi nilai untuk tahun yang hilang
     printf("\nPrediksi untuk Tahun yang Hilang:\n");
     printf("%-6s %-25s %-15s\n", "Tahun", "Persentase Pengguna Internet", "Populasi");
     
-    // Tambahkan data yang hilang ke dataset
-    DataRow new_data[MAX_ROWS + MISSING_YEARS];
-    int new_rows = 0;
+    // Cari tahun yang hilang dari kolom tahun yang sudah terurut (sebelum baris imputasi ditambahkan),
+    // dibatasi pada rentang tahun baris yang memiliki data valid
+    int first_valid = 0;
+    int last_valid = dataset.rows - 1;
+    while (first_valid <= last_valid && dataset.valid[first_valid] == 0) {
+        first_valid++;
+    }
+    while (last_valid >= first_valid && dataset.valid[last_valid] == 0) {
+        last_valid--;
+    }
+    int valid_span = last_valid - first_valid + 1;
+    int refused_gaps = 0;
+    int64_t missing_count = findMissingYears(dataset.year + first_valid, valid_span, MAX_YEAR_GAP, NULL, 0, &refused_gaps);
+    if (refused_gaps > 0) {
+        printf("Peringatan: %d celah lebih dari %d tahun tidak diisi (periksa kolom tahun)\n", refused_gaps, MAX_YEAR_GAP);
+    }
+    if (missing_count > INT_MAX - dataset.rows) {
+        printf("Error: Terlalu banyak tahun yang hilang (%lld), imputasi dilewati\n", (long long)missing_count);
+        missing_count = 0;
+    }
+    int n_missing = (int)missing_count;
+    int* missing_years = (int*)malloc((n_missing > 0 ? n_missing : 1) * sizeof(int));
+    if (missing_years == NULL) {
+        n_missing = 0;
+    } else {
+        findMissingYears(dataset.year + first_valid, valid_span, MAX_YEAR_GAP, missing_years, n_missing, NULL);
+    }
     
-    // Salin data yang ada ke dataset baru
-    for (int i = 0; i < rows; i++) {
-        new_data[new_rows++] = data[i];
+    // Prediksi semua tahun yang hilang sekaligus untuk setiap model: persentase dipotong ke
+    // [0, 100], populasi >= 0
+    const FittedModel* exponential_internet = &internet_models[1];
+    const FittedModel* linear_population = &population_models[0];
+    int exponential_ok = exponential_internet->status <= FIT_ILL_CONDITIONED &&
+                         linear_population->status <= FIT_ILL_CONDITIONED;
+    MissingPredictions predictions;
+    if (!initMissingPredictions(&predictions, n_missing)) {
+        n_missing = 0;
+    } else {
+        for (int i = 0; i < n_missing; i++) {
+            predictions.x[i] = (double)(missing_years[i] - base_year);
+        }
+        predictPolynomialBatch(coef_internet, degree_internet, predictions.x, n_missing,
+                               predictions.polynomial_percentage, 0, 100);
+        predictPolynomialBatch(coef_population, degree_population, predictions.x, n_missing,
+                               predictions.polynomial_population, 0, HUGE_VAL);
+        if (tournament_best[0] >= 0) {
+            predictModel(&tournament_models[tournament_best[0]], predictions.x, n_missing,
+                         predictions.tournament_percentage, 0, 100);
+        } else {
+            memcpy(predictions.tournament_percentage, predictions.polynomial_percentage, n_missing * sizeof(double));
+        }
+        if (tournament_best[1] >= 0) {
+            predictModel(&tournament_models[TOURNAMENT_CANDIDATES + tournament_best[1]], predictions.x, n_missing,
+                         predictions.tournament_population, 0, HUGE_VAL);
+        } else {
+            memcpy(predictions.tournament_population, predictions.polynomial_population, n_missing * sizeof(double));
+        }
+        if (exponential_ok) {
+            predictModel(exponential_internet, predictions.x, n_missing, predictions.exponential_percentage, 0, 100);
+            predictModel(linear_population, predictions.x, n_missing, predictions.linear_population, 0, HUGE_VAL);
+        }
     }
     
     // Tambahkan prediksi untuk tahun yang hilang
-    for (int i = 0; i < MISSING_YEARS; i++) {
+    for (int i = 0; i < n_missing; i++) {
         int year = missing_years[i];
-        double normalized_year = (double)(year - base_year);
+        double predicted_percentage = predictions.polynomial_percentage[i];
+        double predicted_population = predictions.polynomial_population[i];
         
-        // Prediksi persentase internet menggunakan model polinomial
-        double predicted_percentage = evaluatePolynomial(normalized_year, coef_internet, degree_internet);
-        if (predicted_percentage < 0) predicted_percentage = 0; // Koreksi nilai negatif
-        if (predicted_percentage > 100) predicted_percentage = 100; // Koreksi nilai di atas 100%
-        
-        // Prediksi populasi menggunakan model polinomial
-        double predicted_population = evaluatePolynomial(normalized_year, coef_population, degree_population);
-        if (predicted_population < 0) predicted_population = 0; // Koreksi nilai negatif
-        
-        // Tambahkan ke dataset baru
-        new_data[new_rows].year = year;
-        new_data[new_rows].percentage = predicted_percentage;
-        new_data[new_rows].population = predicted_population;
-        new_rows++;
+        // Tambahkan ke dataset
+        appendDatasetRow(&dataset, year, predicted_percentage, predicted_population);
         
         printf("%-6d %-25.6f %-15.0f\n", year, predicted_percentage, predicted_population);
     }
     
-    // Urutkan dataset baru berdasarkan tahun
-    qsort(new_data, new_rows, sizeof(DataRow), compareDataRows);
+    // Urutkan dataset berdasarkan tahun
+    sortDatasetByYear(&dataset);
     
     // Simpan dataset lengkap ke file baru
-    writeCSV("Data_Lengkap_Hasil_Polinomial.csv", new_data, new_rows);
+    writeCSV("Data_Lengkap_Hasil_Polinomial.csv", &dataset);
     
     printf("\nData lengkap telah disimpan ke file 'Data_Lengkap_Hasil_Polinomial.csv'\n");
     
+    // Simpan juga dalam format biner agar dapat dimuat tahap berikutnya tanpa parsing teks.
+    // Jika masukannya file biner ini dan tidak ada tahun yang hilang, kolom dataset masih menunjuk
+    // ke halaman file yang dipetakan; salin dulu agar file dapat diganti dengan aman.
+    if (!detachDataset(&dataset, dataset.rows)) {
+        printf("Error: Memori tidak cukup untuk menyimpan file 'Data_Lengkap_Hasil_Polinomial.bin'\n");
+    } else if (writeDatasetBinary("Data_Lengkap_Hasil_Polinomial.bin", &dataset)) {
+        printf("Data lengkap (biner) telah disimpan ke file 'Data_Lengkap_Hasil_Polinomial.bin'\n");
+    }
+    
+    // Hasil turnamen model; parameter pemenang disimpan lewat serialize keluarganya
+    printf("\n------ Turnamen Model (pemenang menurut RMSE validasi silang 5-fold, dipakai untuk imputasi) ------\n");
+    const char* series_labels[2] = {"Persentase internet", "Populasi"};
+    const char* series_keys[2] = {"persentase_internet", "populasi"};
+    FILE* model_file = fopen("Model_Hasil_Turnamen.txt", "w");
+    int saved_models = 0;
+    for (int s = 0; s < 2; s++) {
+        int winner = tournament_best[s];
+        if (winner < 0) {
+            printf("- %s: tidak ada model yang berhasil, memakai model polinomial\n", series_labels[s]);
+            continue;
+        }
+        const FittedModel* model = &tournament_models[s * TOURNAMENT_CANDIDATES + winner];
+        char name[32];
+        formatModelName(model->family, name, sizeof(name));
+        printf("- %s: pemenang %s (RMSE di luar sampel %.4g)\n", series_labels[s], name,
+            tournament_heldout[s * TOURNAMENT_CANDIDATES + winner]);
+        
+        char serialized[640];
+        int length = model->family->serialize(model, serialized, sizeof(serialized));
+        if (model_file != NULL && length >= 0 && (size_t)length < sizeof(serialized) &&
+            fprintf(model_file, "%s %s\n", series_keys[s], serialized) > 0) {
+            saved_models++;
+        }
+    }
+    if (model_file == NULL || fclose(model_file) != 0) {
+        printf("Error: Tidak dapat menulis file Model_Hasil_Turnamen.txt\n");
+    } else if (saved_models > 0) {
+        printf("Parameter model pemenang telah disimpan ke file 'Model_Hasil_Turnamen.txt'\n");
+    }
+    
+    // Ganti nilai tahun imputasi dengan prediksi pemenang turnamen
+    replaceImputedValues(&dataset, missing_years, n_missing, predictions.tournament_percentage,
+                         predictions.tournament_population);
+    writeCSV("Data_Lengkap_Hasil_Turnamen.csv", &dataset);
+    printf("Data hasil turnamen telah disimpan ke file 'Data_Lengkap_Hasil_Turnamen.csv'\n");
+    
+    // Imputasi dengan model eksponensial untuk persentase internet dan linear untuk populasi
+    // (sebelumnya program terpisah kodepemrogramana.c), dari hasil fitModels yang sama
+    printf("\n------ Model Eksponensial (Persentase Internet) dan Linear (Populasi) ------\n");
+    if (!exponential_ok) {
+        printf("Error: Regresi eksponensial/linear gagal: %s\n",
+            fitStatusMessage(exponential_internet->status > FIT_ILL_CONDITIONED ? exponential_internet->status
+                                                                                : linear_population->status));
+    } else {
+        printf("Model eksponensial: y = %.6f * e^(%.6f * (x - %d))\n", exponential_internet->params[0],
+            exponential_internet->params[1], base_year);
+        printf("Model linear: y = %.2f + %.2f * (x - %d)\n", linear_population->params[0],
+            linear_population->params[1], base_year);
+        printf("%-6s %-25s %-15s\n", "Tahun", "Persentase Pengguna Internet", "Populasi");
+        for (int m = 0; m < n_missing; m++) {
+            printf("%-6d %-25.6f %-15.0f\n", missing_years[m], predictions.exponential_percentage[m],
+                predictions.linear_population[m]);
+        }
+        replaceImputedValues(&dataset, missing_years, n_missing, predictions.exponential_percentage,
+                             predictions.linear_population);
+        writeCSV("Data_Lengkap_Hasil_Eksponensial.csv", &dataset);
+        printf("Data lengkap telah disimpan ke file 'Data_Lengkap_Hasil_Eksponensial.csv'\n");
+    }
+    free(missing_years);
+    free(predictions.x);
+    
     // Prediksi untuk tahun 2030 dan 2035
     printf("\n------ Prediksi Jangka Panjang ------\n");
     
-    // Prediksi populasi Indonesia tahun 2030
-    int year_2030 = 2030;
-    double normalized_year_2030 = (double)(year_2030 - base_year);
-    double predicted_population_2030 = evaluatePolynomial(normalized_year_2030, coef_population, degree_population);
-    if (predicted_population_2030 < 0) predicted_population_2030 = 0; // Koreksi nilai negatif
+    // Prediksi populasi tahun 2030 dan 2035 serta persentase pengguna internet tahun 2035
+    double long_term_x[2] = {(double)(2030 - base_year), (double)(2035 - base_year)};
+    double long_term_population[2];
+    double predicted_percentage_2035;
+    predictPolynomialBatch(coef_population, degree_population, long_term_x, 2, long_term_population, 0, HUGE_VAL);
+    predictPolynomialBatch(coef_internet, degree_internet, &long_term_x[1], 1, &predicted_percentage_2035, 0, 100);
+    double predicted_population_2030 = long_term_population[0];
+    double predicted_population_2035 = long_term_population[1];
     
     printf("Estimasi Populasi Indonesia tahun 2030: %.0f jiwa\n", predicted_population_2030);
     
-    // Prediksi persentase pengguna internet Indonesia tahun 2035
-    int year_2035 = 2035;
-    double normalized_year_2035 = (double)(year_2035 - base_year);
-    double predicted_percentage_2035 = evaluatePolynomial(normalized_year_2035, coef_internet, degree_internet);
-    if (predicted_percentage_2035 < 0) predicted_percentage_2035 = 0; // Koreksi nilai negatif
-    if (predicted_percentage_2035 > 100) predicted_percentage_2035 = 100; // Koreksi nilai di atas 100%
-    
-    // Prediksi populasi untuk tahun 2035
-    double predicted_population_2035 = evaluatePolynomial(normalized_year_2035, coef_population, degree_population);
-    if (predicted_population_2035 < 0) predicted_population_2035 = 0;
-    
     // Hitung jumlah pengguna internet berdasarkan persentase dan populasi
     double internet_users_2035 = (predicted_percentage_2035 / 100.0) * predicted_population_2035;
     
@@ -429,11 +4419,36 @@ int main() {
     printf("Estimasi Populasi Indonesia tahun 2035: %.0f jiwa\n", predicted_population_2035);
     printf("Estimasi Jumlah Pengguna Internet Indonesia tahun 2035: %.0f jiwa\n", internet_users_2035);
     
+    // Pembanding: prediksi model logistik tanpa pemotongan; batas jenuh K diperkirakan dari data
+    // dengan K <= 100%, sehingga kurva sendiri tidak pernah melewati 100%
+    const FittedModel* logistic_internet = &internet_models[3];
+    if (logistic_internet->status <= FIT_ILL_CONDITIONED) {
+        double logistic_2035;
+        predictModel(logistic_internet, &long_term_x[1], 1, &logistic_2035, -HUGE_VAL, HUGE_VAL);
+        printf("Estimasi Persentase Pengguna Internet tahun 2035 (model logistik, jenuh di %.2f%%): %.2f%%\n",
+            logistic_internet->params[0], logistic_2035);
+    }
+    
     // Tambahkan catatan evaluasi model
     printf("\n------ Evaluasi Model ------\n");
     printf("Model regresi polinomial memiliki nilai R² sebagai berikut:\n");
     printf("- Model persentase internet: %.4f (semakin mendekati 1 semakin baik)\n", r_squared_internet);
     printf("- Model populasi: %.4f (semakin mendekati 1 semakin baik)\n", r_squared_population);
+    printf("\nGalat validasi silang (RMSE di luar sampel, semakin kecil semakin baik):\n");
+    if (cv_internet_ok) {
+        printf("- Model persentase internet: LOOCV %.4f, 5-fold %.4f poin persen\n", loo_internet, kfold_internet);
+    } else {
+        printf("- Model persentase internet: validasi silang tidak dapat dihitung\n");
+    }
+    if (cv_population_ok) {
+        printf("- Model populasi: LOOCV %.0f, 5-fold %.0f jiwa\n", loo_population, kfold_population);
+    } else {
+        printf("- Model populasi: validasi silang tidak dapat dihitung\n");
+    }
+    printf("\nPerbandingan keluarga model (kecocokan dalam sampel menurut R² terkoreksi;\n");
+    printf("model imputasi dipilih oleh turnamen RMSE validasi silang di atas):\n");
+    printModelComparison("Persentase internet", internet_models, 5, best_internet);
+    printModelComparison("Populasi", population_models, 5, best_population);
     
     // Catatan tentang ekstrapolasi jangka panjang
     printf("\nCATATAN: Prediksi jangka panjang (tahun 2030 dan 2035) perlu diinterpretasikan dengan hati-hati\n");
@@ -442,8 +4457,15 @@ int main() {
     printf("perkembangan teknologi, dan dinamika sosial-ekonomi dapat mengubah tren historis secara drastis.\n");
     
     // Bersihkan memori
+    freeDataset(&dataset);
+    free(normalized_years);
+    free(normalized_years_internet);
+    free(percentages);
+    free(population_x_buffer);
+    free(population_y_buffer);
     free(coef_internet);
     free(coef_population);
+    freeFitContext(&fit_context);
     
     return 0;
 }
\ No newline at end of file